@@ -0,0 +1,423 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ * SPDX-FileCopyrightText: Copyright The LanceDB Authors
+ */
+
+// Reproducible benchmarks of the hot paths of the C API.
+//
+// Every measurement is appended as one JSON object per line to the file named by
+// LANCEDB_BENCHMARK_OUTPUT (default: lancedb_benchmarks.jsonl in the working directory).
+// Workload sizes can be scaled with LANCEDB_BENCHMARK_ROWS and LANCEDB_BENCHMARK_QUERIES.
+// All data and query vectors are generated from fixed seeds.
+
+#include "test_common.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#ifndef LANCEDB_C_VERSION
+#define LANCEDB_C_VERSION "unknown"
+#endif
+
+// Dimension of the vectors of the index and query workloads
+constexpr size_t BENCHMARK_DIMENSIONS = 128;
+// Rows per batch of the ingest workloads
+constexpr int BENCHMARK_BATCH_ROWS = 1000;
+// Results per vector query
+constexpr size_t BENCHMARK_TOP_K = 10;
+
+using Clock = std::chrono::steady_clock;
+
+static size_t env_size(const char* name, size_t default_value) {
+  const char* value = std::getenv(name);
+  if (value == nullptr || *value == '\0') {
+    return default_value;
+  }
+  return static_cast<size_t>(std::strtoull(value, nullptr, 10));
+}
+
+static size_t benchmark_rows() {
+  return env_size("LANCEDB_BENCHMARK_ROWS", 20000);
+}
+
+static size_t benchmark_queries() {
+  return env_size("LANCEDB_BENCHMARK_QUERIES", 200);
+}
+
+static double elapsed_seconds(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Append one measurement to the benchmark output
+static void report(const std::string& benchmark, const std::vector<std::pair<std::string, double>>& values) {
+  const char* path = std::getenv("LANCEDB_BENCHMARK_OUTPUT");
+  std::ofstream out(path != nullptr && *path != '\0' ? path : "lancedb_benchmarks.jsonl", std::ios::app);
+  REQUIRE(out.is_open());
+
+  out << "{\"benchmark\":\"" << benchmark << "\",\"version\":\"" << LANCEDB_C_VERSION << "\"";
+  for (const auto& [key, value] : values) {
+    out << ",\"" << key << "\":" << std::setprecision(9) << value;
+  }
+  out << "}\n";
+}
+
+// Latency summary of repeated operations, in milliseconds
+struct LatencySummary {
+  double mean_ms;
+  double p50_ms;
+  double p99_ms;
+  double max_ms;
+  double total_seconds;
+};
+
+static LatencySummary summarize(std::vector<double> seconds) {
+  REQUIRE(!seconds.empty());
+  std::sort(seconds.begin(), seconds.end());
+  auto percentile = [&](double p) {
+    size_t index = static_cast<size_t>(p * static_cast<double>(seconds.size() - 1) + 0.5);
+    return seconds[index] * 1000.0;
+  };
+  double total = std::accumulate(seconds.begin(), seconds.end(), 0.0);
+  return {total * 1000.0 / seconds.size(), percentile(0.50), percentile(0.99), seconds.back() * 1000.0, total};
+}
+
+static std::vector<float> random_vector(std::mt19937& gen, size_t dimensions) {
+  std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+  std::vector<float> vector(dimensions);
+  for (auto& value : vector) {
+    value = dis(gen);
+  }
+  return vector;
+}
+
+// Record batch with the test schema layout and random vectors of BENCHMARK_DIMENSIONS
+static std::shared_ptr<arrow::RecordBatch> create_random_vector_batch(int num_rows, int start_index, std::mt19937& gen) {
+  auto schema = arrow::schema({
+    arrow::field("key", arrow::utf8()),
+    arrow::field("data", arrow::fixed_size_list(arrow::float32(), BENCHMARK_DIMENSIONS))
+  });
+
+  arrow::StringBuilder key_builder;
+  arrow::FixedSizeListBuilder data_builder(arrow::default_memory_pool(),
+      std::make_unique<arrow::FloatBuilder>(), BENCHMARK_DIMENSIONS);
+  auto value_builder = static_cast<arrow::FloatBuilder*>(data_builder.value_builder());
+
+  for (int i = 0; i < num_rows; i++) {
+    REQUIRE(key_builder.Append("key_" + std::to_string(start_index + i)).ok());
+    REQUIRE(value_builder->AppendValues(random_vector(gen, BENCHMARK_DIMENSIONS)).ok());
+    REQUIRE(data_builder.Append().ok());
+  }
+
+  std::shared_ptr<arrow::Array> key_array, data_array;
+  REQUIRE(key_builder.Finish(&key_array).ok());
+  REQUIRE(data_builder.Finish(&data_array).ok());
+  return arrow::RecordBatch::Make(schema, num_rows, {key_array, data_array});
+}
+
+static LanceDBVectorIndexConfig default_index_config() {
+  return {
+    .num_partitions = -1,
+    .num_sub_vectors = -1,
+    .max_iterations = -1,
+    .sample_rate = 0.0f,
+    .distance_type = LANCEDB_DISTANCE_L2,
+    .accelerator = nullptr,
+    .replace = 1
+  };
+}
+
+static void require_success(LanceDBError result, char* error_message) {
+  if (error_message) {
+    INFO("Error message: " << error_message);
+    lancedb_free_string(error_message);
+  }
+  REQUIRE(result == LANCEDB_SUCCESS);
+}
+
+// Fixture with a table of random vectors
+class VectorBenchmarkFixture : public LanceDBFixture {
+protected:
+  std::mt19937 gen{42};
+
+  LanceDBTable* create_vector_table(const std::string& table_name, size_t num_rows) {
+    auto batch = create_random_vector_batch(static_cast<int>(num_rows), 0, gen);
+
+    struct ArrowSchema c_schema;
+    REQUIRE(arrow::ExportSchema(*batch->schema(), &c_schema).ok());
+
+    LanceDBTable* table = nullptr;
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_create(
+        db, table_name.c_str(), reinterpret_cast<FFI_ArrowSchema*>(&c_schema),
+        create_reader_from_batch(batch), &table, &error_message);
+    if (c_schema.release) {
+      c_schema.release(&c_schema);
+    }
+    require_success(result, error_message);
+    REQUIRE(table != nullptr);
+    return table;
+  }
+
+  void create_index(LanceDBTable* table, LanceDBIndexType index_type) {
+    const char* columns[] = {"data"};
+    LanceDBVectorIndexConfig config = default_index_config();
+    char* error_message = nullptr;
+    require_success(
+        lancedb_table_create_vector_index(table, columns, 1, index_type, &config, &error_message), error_message);
+  }
+};
+
+// Drain a query result into a reused caller buffer; returns the number of rows
+static int64_t drain_result(LanceDBQueryResult* query_result) {
+  REQUIRE(query_result != nullptr);
+  ArrowArray arrays[4];
+  int64_t rows = 0;
+  while (true) {
+    size_t count = 0;
+    char* error_message = nullptr;
+    require_success(lancedb_query_result_next_batches(
+        query_result, reinterpret_cast<FFI_ArrowArray*>(arrays), 4, &count, &error_message), error_message);
+    for (size_t i = 0; i < count; i++) {
+      rows += arrays[i].length;
+      arrays[i].release(&arrays[i]);
+    }
+    if (count < 4) {
+      break;
+    }
+  }
+  lancedb_query_result_free(query_result);
+  return rows;
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "Benchmark - table add", "[benchmark]") {
+  const size_t num_batches = std::max<size_t>(1, benchmark_rows() / BENCHMARK_BATCH_ROWS);
+  create_empty_table("add_benchmark");
+
+  LanceDBTable* table = lancedb_connection_open_table(db, "add_benchmark");
+  REQUIRE(table != nullptr);
+
+  std::vector<double> latencies;
+  for (size_t i = 0; i < num_batches; i++) {
+    auto reader = create_reader_from_batch(
+        create_test_record_batch(BENCHMARK_BATCH_ROWS, static_cast<int>(i) * BENCHMARK_BATCH_ROWS));
+    REQUIRE(reader != nullptr);
+
+    char* error_message = nullptr;
+    auto start = Clock::now();
+    LanceDBError result = lancedb_table_add(table, reader, &error_message);
+    latencies.push_back(elapsed_seconds(start));
+    require_success(result, error_message);
+  }
+
+  auto summary = summarize(latencies);
+  double rows = static_cast<double>(num_batches * BENCHMARK_BATCH_ROWS);
+  report("table_add", {
+    {"rows", rows},
+    {"batch_rows", static_cast<double>(BENCHMARK_BATCH_ROWS)},
+    {"rows_per_sec", rows / summary.total_seconds},
+    {"p50_ms", summary.p50_ms},
+    {"p99_ms", summary.p99_ms},
+    {"max_ms", summary.max_ms}
+  });
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "Benchmark - merge insert", "[benchmark]") {
+  const int num_rows = static_cast<int>(benchmark_rows());
+  LanceDBTable* table = create_table_with_data("merge_insert_benchmark", num_rows, 0);
+  REQUIRE(table != nullptr);
+
+  // Each round updates the upper half of the keys and inserts as many new keys
+  constexpr int rounds = 3;
+  const char* on_columns[] = {"key"};
+  LanceDBMergeInsertConfig config = {
+    .struct_size = sizeof(LanceDBMergeInsertConfig),
+    .when_matched_update_all = 1,
+    .when_not_matched_insert_all = 1,
+    .when_matched_update_filter = nullptr,
+    .when_not_matched_by_source_delete = 0,
+    .when_not_matched_by_source_delete_filter = nullptr,
+    .source_dedup = LANCEDB_MERGE_DEDUP_NONE
+  };
+
+  std::vector<double> latencies;
+  int table_rows = num_rows;
+  for (int round = 0; round < rounds; round++) {
+    auto reader = create_reader_from_batch(create_test_record_batch(num_rows, table_rows - num_rows / 2));
+    REQUIRE(reader != nullptr);
+
+    char* error_message = nullptr;
+    auto start = Clock::now();
+    LanceDBError result = lancedb_table_merge_insert(table, reader, on_columns, 1, &config, &error_message);
+    latencies.push_back(elapsed_seconds(start));
+    require_success(result, error_message);
+    table_rows += num_rows - num_rows / 2;
+  }
+  REQUIRE(lancedb_table_count_rows(table) == static_cast<unsigned long long>(table_rows));
+
+  auto summary = summarize(latencies);
+  report("merge_insert", {
+    {"source_rows", static_cast<double>(num_rows)},
+    {"rounds", static_cast<double>(rounds)},
+    {"rows_per_sec", static_cast<double>(num_rows) * rounds / summary.total_seconds},
+    {"p50_ms", summary.p50_ms},
+    {"max_ms", summary.max_ms}
+  });
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(VectorBenchmarkFixture, "Benchmark - vector index build", "[benchmark]") {
+  const size_t num_rows = benchmark_rows();
+  LanceDBTable* table = create_vector_table("index_build_benchmark", num_rows);
+
+  const std::vector<std::pair<const char*, LanceDBIndexType>> index_types = {
+    {"index_build_ivf_pq", LANCEDB_INDEX_IVF_PQ},
+    {"index_build_ivf_hnsw_pq", LANCEDB_INDEX_IVF_HNSW_PQ},
+    {"index_build_ivf_hnsw_sq", LANCEDB_INDEX_IVF_HNSW_SQ}
+  };
+  for (const auto& [name, index_type] : index_types) {
+    auto start = Clock::now();
+    create_index(table, index_type);
+    double seconds = elapsed_seconds(start);
+    report(name, {
+      {"rows", static_cast<double>(num_rows)},
+      {"dimensions", static_cast<double>(BENCHMARK_DIMENSIONS)},
+      {"seconds", seconds},
+      {"rows_per_sec", num_rows / seconds}
+    });
+  }
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(VectorBenchmarkFixture, "Benchmark - vector query", "[benchmark]") {
+  const size_t num_rows = benchmark_rows();
+  const size_t num_queries = benchmark_queries();
+  LanceDBTable* table = create_vector_table("vector_query_benchmark", num_rows);
+  create_index(table, LANCEDB_INDEX_IVF_PQ);
+
+  std::mt19937 query_gen(7);
+  std::vector<std::vector<float>> query_vectors;
+  for (size_t i = 0; i < num_queries; i++) {
+    query_vectors.push_back(random_vector(query_gen, BENCHMARK_DIMENSIONS));
+  }
+
+  // nprobes = 0 runs a flat search that bypasses the index
+  const std::vector<size_t> nprobes_values = {0, 1, 10, 50};
+  const std::vector<unsigned int> refine_factors = {0, 5};
+  for (size_t nprobes : nprobes_values) {
+    for (unsigned int refine_factor : refine_factors) {
+      if (nprobes == 0 && refine_factor > 0) {
+        continue;
+      }
+
+      std::vector<double> latencies;
+      for (const auto& query_vector : query_vectors) {
+        auto start = Clock::now();
+        LanceDBVectorQuery* query = lancedb_vector_query_new(table, query_vector.data(), BENCHMARK_DIMENSIONS);
+        REQUIRE(query != nullptr);
+        REQUIRE(lancedb_vector_query_limit(query, BENCHMARK_TOP_K, nullptr) == LANCEDB_SUCCESS);
+        if (nprobes == 0) {
+          REQUIRE(lancedb_vector_query_bypass_vector_index(query, nullptr) == LANCEDB_SUCCESS);
+        } else {
+          REQUIRE(lancedb_vector_query_nprobes(query, nprobes, nullptr) == LANCEDB_SUCCESS);
+        }
+        if (refine_factor > 0) {
+          REQUIRE(lancedb_vector_query_refine_factor(query, refine_factor, nullptr) == LANCEDB_SUCCESS);
+        }
+        int64_t rows = drain_result(lancedb_vector_query_execute(query));
+        latencies.push_back(elapsed_seconds(start));
+        REQUIRE(rows == static_cast<int64_t>(BENCHMARK_TOP_K));
+      }
+
+      auto summary = summarize(latencies);
+      report("vector_query", {
+        {"rows", static_cast<double>(num_rows)},
+        {"nprobes", static_cast<double>(nprobes)},
+        {"refine_factor", static_cast<double>(refine_factor)},
+        {"queries", static_cast<double>(num_queries)},
+        {"qps", num_queries / summary.total_seconds},
+        {"mean_ms", summary.mean_ms},
+        {"p50_ms", summary.p50_ms},
+        {"p99_ms", summary.p99_ms}
+      });
+    }
+  }
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(VectorBenchmarkFixture, "Benchmark - result export", "[benchmark]") {
+  const size_t num_queries = benchmark_queries();
+  LanceDBTable* table = create_vector_table("result_export_benchmark", benchmark_rows());
+
+  std::mt19937 query_gen(7);
+  std::vector<float> query_vector = random_vector(query_gen, BENCHMARK_DIMENSIONS);
+
+  // The same flat top-k search with each way of handing the result to the caller
+  auto execute = [&]() {
+    LanceDBVectorQuery* query = lancedb_vector_query_new(table, query_vector.data(), BENCHMARK_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_vector_query_limit(query, BENCHMARK_TOP_K, nullptr) == LANCEDB_SUCCESS);
+    LanceDBQueryResult* query_result = lancedb_vector_query_execute(query);
+    REQUIRE(query_result != nullptr);
+    return query_result;
+  };
+
+  const std::vector<std::pair<const char*, std::function<void()>>> paths = {
+    {"to_arrow", [&]() {
+      FFI_ArrowArray** result_arrays = nullptr;
+      FFI_ArrowSchema* result_schema = nullptr;
+      size_t count = 0;
+      REQUIRE(lancedb_query_result_to_arrow(
+          execute(), &result_arrays, &result_schema, &count, nullptr) == LANCEDB_SUCCESS);
+      lancedb_free_arrow_arrays(result_arrays, count);
+      lancedb_free_arrow_schema(result_schema);
+    }},
+    {"next_batch", [&]() {
+      LanceDBQueryResult* query_result = execute();
+      FFI_ArrowArray* batch = nullptr;
+      while (lancedb_query_result_next_batch(query_result, &batch, nullptr) == LANCEDB_SUCCESS && batch != nullptr) {
+        lancedb_free_arrow_array(batch);
+      }
+      lancedb_query_result_free(query_result);
+    }},
+    {"next_batches", [&]() {
+      drain_result(execute());
+    }},
+    {"arrow_stream", [&]() {
+      struct ArrowArrayStream c_stream;
+      REQUIRE(lancedb_query_result_to_arrow_stream(
+          execute(), reinterpret_cast<FFI_ArrowArrayStream*>(&c_stream), nullptr) == LANCEDB_SUCCESS);
+      auto reader = arrow::ImportRecordBatchReader(&c_stream);
+      REQUIRE(reader.ok());
+      REQUIRE((*reader)->ToTable().ok());
+    }}
+  };
+
+  for (const auto& [path, run] : paths) {
+    std::vector<double> latencies;
+    for (size_t i = 0; i < num_queries; i++) {
+      auto start = Clock::now();
+      run();
+      latencies.push_back(elapsed_seconds(start));
+    }
+
+    auto summary = summarize(latencies);
+    report(std::string("result_export_") + path, {
+      {"top_k", static_cast<double>(BENCHMARK_TOP_K)},
+      {"queries", static_cast<double>(num_queries)},
+      {"mean_ms", summary.mean_ms},
+      {"p50_ms", summary.p50_ms},
+      {"p99_ms", summary.p99_ms}
+    });
+  }
+
+  lancedb_table_free(table);
+}
@@ -511,7 +511,8 @@ int main() {
             // upsert the new data to table
             std::array<const char*, 1> on_columns = {"key"};
             //
-            const LanceDBMergeInsertConfig config{.when_matched_update_all = 1,
+            const LanceDBMergeInsertConfig config{.struct_size = sizeof(LanceDBMergeInsertConfig),
+              .when_matched_update_all = 1,
               .when_not_matched_insert_all = 1};
             if (const LanceDBError result = lancedb_table_merge_insert(
                   tbl,
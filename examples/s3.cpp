@@ -81,6 +81,18 @@ int main(int argc, char** argv) {
   builder = lancedb_connect_builder_storage_option(builder, "allow_http", "true");
   builder = lancedb_connect_builder_storage_option(builder, "aws_s3_addressing_style", "path");
 
+  // merge nearby reads into larger requests and keep data and index reads in a local cache
+  LanceDBObjectStoreConfig store_config;
+  lancedb_object_store_config_init(&store_config);
+  store_config.block_size = 1024 * 1024;
+  store_config.disk_cache_path = "/tmp";
+  store_config.disk_cache_bytes = 1024ull * 1024 * 1024;
+  builder = lancedb_connect_builder_object_store_config(builder, &store_config);
+  if (!builder) {
+    std::cerr << "failed to configure object store" << std::endl;
+    return 1;
+  }
+
   LanceDBConnection* db = lancedb_connect_builder_execute(builder);
   if (!db) {
     std::cerr << "failed to connect to database" << std::endl;
@@ -52,6 +52,32 @@ typedef struct LanceDBQueryResult LanceDBQueryResult;
  */
 typedef struct LanceDBRecordBatchReader LanceDBRecordBatchReader;
 
+/**
+ * Opaque handle to an asynchronous LanceDB operation
+ */
+typedef struct LanceDBFuture LanceDBFuture;
+
+/**
+ * Opaque handle to a LanceDB bulk load
+ */
+typedef struct LanceDBBulkLoader LanceDBBulkLoader;
+
+/**
+ * Opaque handle to a LanceDB maintenance scheduler
+ */
+typedef struct LanceDBMaintenanceScheduler LanceDBMaintenanceScheduler;
+
+/**
+ * Completion callback for asynchronous operations
+ *
+ * Invoked exactly once from a LanceDB runtime thread after the operation finished,
+ * failed, panicked or was cancelled, at which point the result can be fetched from the
+ * future without blocking.
+ * The callback must not block; a typical implementation writes to an eventfd or pipe
+ * watched by the caller's event loop.
+ */
+typedef void (*LanceDBCompletionCallback)(void* user_data);
+
 /**
  * Arrow C ABI Schema structure (opaque)
  */
@@ -62,6 +88,11 @@ typedef struct FFI_ArrowSchema FFI_ArrowSchema;
  */
 typedef struct FFI_ArrowArray FFI_ArrowArray;
 
+/**
+ * Arrow C Stream ABI structure (opaque)
+ */
+typedef struct FFI_ArrowArrayStream FFI_ArrowArrayStream;
+
 /**
  * Error codes for LanceDB C API
  */
@@ -144,6 +175,15 @@ typedef enum {
     LANCEDB_DISTANCE_HAMMING = 3
 } LanceDBDistanceType;
 
+/**
+ * Element type of query vector buffers
+ */
+typedef enum {
+    LANCEDB_VECTOR_FLOAT32 = 0, // 32-bit floats
+    LANCEDB_VECTOR_FLOAT16 = 1, // IEEE 754 half precision bit patterns
+    LANCEDB_VECTOR_UINT8 = 2    // Bit-packed binary vectors (dimension counted in bytes)
+} LanceDBVectorElementType;
+
 /**
  * Index type enum
  */
@@ -156,7 +196,9 @@ typedef enum {
     LANCEDB_INDEX_IVF_FLAT = 5,
     LANCEDB_INDEX_IVF_PQ = 6,
     LANCEDB_INDEX_IVF_HNSW_PQ = 7,
-    LANCEDB_INDEX_IVF_HNSW_SQ = 8
+    LANCEDB_INDEX_IVF_HNSW_SQ = 8,
+    LANCEDB_INDEX_IVF_SQ = 9,
+    LANCEDB_INDEX_IVF_RQ = 10
 } LanceDBIndexType;
 
 /**
@@ -169,6 +211,26 @@ typedef enum {
     LANCEDB_OPTIMIZE_INDEX = 3    // Only rebuild indices
 } LanceDBOptimizeType;
 
+/**
+ * Index statistics
+ */
+typedef struct {
+    LanceDBIndexType index_type;  // Type of the index (AUTO if not representable)
+    unsigned long long num_indexed_rows;   // Rows covered by the index
+    unsigned long long num_unindexed_rows; // Rows added since the index was built or updated
+    unsigned int num_indices;              // Number of index segments, 1 + the number of deltas (0 = unknown)
+} LanceDBIndexStats;
+
+/**
+ * Fragment of a table version
+ */
+typedef struct {
+    unsigned long long id;               // Fragment ID, stable across versions
+    unsigned long long num_rows;         // Rows in the fragment, excluding deleted rows
+    unsigned long long num_deleted_rows; // Rows marked as deleted
+    unsigned long long size_bytes;       // Size of the data files (0 if not recorded)
+} LanceDBFragmentInfo;
+
 /**
  * Vector index configuration
  */
@@ -178,10 +240,25 @@ typedef struct {
     int max_iterations;         // Maximum training iterations (-1 = default)
     float sample_rate;          // Sampling rate for training (0.0 = default)
     LanceDBDistanceType distance_type; // Distance metric
-    const char* accelerator;    // GPU accelerator ("cuda", "mps", or NULL for CPU)
+    const char* accelerator;    // Training device ("cuda", "mps", or NULL / "cpu" for CPU)
     int replace;               // Replace existing index (1 = true, 0 = false)
 } LanceDBVectorIndexConfig;
 
+/**
+ * Advanced vector index build parameters
+ *
+ * Initialize with lancedb_vector_index_params_init() before setting fields. The struct
+ * is versioned by struct_size: fields added in later releases take their defaults for
+ * callers built against this header.
+ */
+typedef struct {
+    size_t struct_size;             // sizeof(LanceDBVectorIndexParams), set by init
+    unsigned int m;                     // HNSW edges per node (0 = default 20)
+    unsigned int ef_construction;       // HNSW candidate list size while building the graph (0 = default 300)
+    unsigned int num_bits;              // PQ bits per sub-vector code, 4 or 8 (0 = default 8); RQ bits per dimension (0 = default 1)
+    unsigned int target_partition_size; // IVF rows per partition if num_partitions is auto (0 = default)
+} LanceDBVectorIndexParams;
+
 /**
  * Scalar index configuration
  */
@@ -204,14 +281,268 @@ typedef struct {
     int replace;                 // Replace existing index (1 = true, 0 = false)
 } LanceDBFtsIndexConfig;
 
+/**
+ * Reranker type enum for hybrid queries
+ */
+typedef enum {
+    LANCEDB_RERANKER_RRF = 0,    // Reciprocal rank fusion
+    LANCEDB_RERANKER_LINEAR = 1  // Linear combination of vector and text scores
+} LanceDBRerankerType;
+
+/**
+ * Score normalization applied before reranking
+ */
+typedef enum {
+    LANCEDB_NORMALIZE_SCORE = 0, // Normalize the raw scores
+    LANCEDB_NORMALIZE_RANK = 1   // Use the ranks instead of the raw scores
+} LanceDBNormalizeMethod;
+
+/**
+ * Hybrid query reranker configuration
+ */
+typedef struct {
+    LanceDBRerankerType reranker_type; // Reranker combining both result sets
+    float rrf_k;                       // RRF rank constant (0.0 = default 60)
+    float linear_weight;               // Weight of the vector score for linear reranking (< 0.0 = default 0.7)
+    LanceDBNormalizeMethod normalize;  // Normalization of scores before reranking
+} LanceDBRerankerConfig;
+
+/**
+ * Handling of source records with duplicate merge keys
+ */
+typedef enum {
+    LANCEDB_MERGE_DEDUP_NONE = 0,  // Use the source as is; duplicate keys fail the merge
+    LANCEDB_MERGE_DEDUP_FIRST = 1, // Keep the first source record of each key (streaming)
+    LANCEDB_MERGE_DEDUP_LAST = 2   // Keep the last source record of each key (buffers the source)
+} LanceDBMergeInsertDedup;
+
 /**
  * Merge insert configuration
+ *
+ * Filters are SQL expressions that can refer to the existing row as "target" and
+ * the new row as "source", e.g. "target.updated_at < source.updated_at". Use a
+ * when_matched_update_filter to skip unchanged rows, so they are not rewritten.
+ *
+ * Initialize with lancedb_merge_insert_config_init() before setting fields. The struct
+ * is versioned by struct_size: fields added in later releases take their defaults for
+ * callers built against this header. A struct_size of 0 is read as this layout, so
+ * designated initializers that leave it unset keep working; binaries built against a
+ * header without struct_size must be rebuilt.
  */
 typedef struct {
+    size_t struct_size;              // sizeof(LanceDBMergeInsertConfig), set by init (0 = this layout)
     int when_matched_update_all;     // Update all columns for matched records (1 = true, 0 = false)
     int when_not_matched_insert_all; // Insert all new records (1 = true, 0 = false)
+    const char* when_matched_update_filter;   // Only update matched records satisfying this condition (NULL = all)
+    int when_not_matched_by_source_delete;    // Delete target records missing from the source (1 = true, 0 = false)
+    const char* when_not_matched_by_source_delete_filter; // Only delete records satisfying this condition (NULL = all)
+    LanceDBMergeInsertDedup source_dedup;     // Handling of source records with duplicate keys
 } LanceDBMergeInsertConfig;
 
+/**
+ * Write configuration controlling the layout of written data files
+ *
+ * Initialize with lancedb_write_config_init() before setting fields. The struct
+ * is versioned by struct_size: fields added in later releases take their defaults for
+ * callers built against this header.
+ */
+typedef struct {
+    size_t struct_size;         // sizeof(LanceDBWriteConfig), set by init
+    size_t max_rows_per_file;   // Maximum rows per data file (0 = default)
+    size_t max_rows_per_group;  // Maximum rows per row group (0 = default)
+    size_t max_bytes_per_file;  // Soft limit of bytes per data file (0 = default)
+} LanceDBWriteConfig;
+
+/**
+ * Object store configuration
+ *
+ * Initialize with lancedb_object_store_config_init() before setting fields. The struct
+ * is versioned by struct_size: fields added in later releases take their defaults for
+ * callers built against this header.
+ */
+typedef struct {
+    size_t struct_size;                    // sizeof(LanceDBObjectStoreConfig), set by init
+    unsigned int max_concurrent_requests;  // Concurrent requests per store (0 = Lance default)
+    unsigned long long block_size;         // Bytes; reads closer than this are merged into one request (0 = Lance default)
+    unsigned long long max_request_size;   // Bytes; larger reads are split into several requests (0 = default of 16 MiB)
+    unsigned long long request_timeout_ms; // Timeout of a single request (0 = default of 30 s)
+    unsigned long long connect_timeout_ms; // Timeout for establishing a connection (0 = default of 5 s)
+    unsigned int max_retries;              // Retries of a failed request (0 = default of 10)
+    unsigned long long retry_timeout_ms;   // Total time spent retrying a request, rounded up to seconds (0 = default of 180 s)
+    const char* disk_cache_path;           // Directory of the local disk cache (NULL = no disk cache)
+    unsigned long long disk_cache_bytes;   // Size cap of the disk cache (0 = no disk cache)
+} LanceDBObjectStoreConfig;
+
+/**
+ * Memory usage of a connection
+ */
+typedef struct {
+    size_t current_bytes; // Bytes of query results and ingested batches still alive
+    size_t peak_bytes;    // Highest current_bytes since the connection was created
+    size_t limit_bytes;   // Configured limit (0 = unlimited)
+} LanceDBMemoryStats;
+
+/**
+ * Callback invoked on every runtime thread right after it starts
+ *
+ * @param thread_index - sequential index of the started thread (0, 1, 2, ...)
+ * @param user_data - opaque pointer from LanceDBRuntimeConfig
+ *
+ * Typical use is pinning the thread to a CPU set, e.g. with pthread_setaffinity_np().
+ * The callback runs for worker threads as well as blocking pool threads.
+ */
+typedef void (*LanceDBThreadStartCallback)(size_t thread_index, void* user_data);
+
+/**
+ * Runtime configuration
+ */
+typedef struct {
+    int worker_threads;                         // Number of worker threads (-1 = one per core)
+    int max_blocking_threads;                   // Maximum threads of the blocking pool (-1 = default)
+    const char* thread_name_prefix;             // Prefix of runtime thread names (NULL = default)
+    int current_thread;                         // Use a runtime driven by the calling threads (1 = true, 0 = false)
+    LanceDBThreadStartCallback on_thread_start; // Called on each new runtime thread (NULL = none)
+    void* user_data;                            // Opaque pointer passed to on_thread_start
+} LanceDBRuntimeConfig;
+
+/**
+ * Initialize the runtime used for all LanceDB operations
+ *
+ * @param config - pointer to LanceDBRuntimeConfig
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * By default LanceDB lazily creates a multi-threaded runtime with one worker per core on
+ * first use. Call this function before any other LanceDB function to size the runtime
+ * to fit the application's own thread pools. It fails with LANCEDB_RUNTIME if the runtime
+ * was already initialized.
+ *
+ * When current_thread is set, no worker threads are started: work only makes progress
+ * while a calling thread is inside a blocking LanceDB function (including
+ * lancedb_future_get() and lancedb_future_get_query_result()), so completion callbacks of
+ * asynchronous operations are not invoked on their own.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_runtime_init(
+    const LanceDBRuntimeConfig* config,
+    char** error_message
+);
+
+/**
+ * Number of latency histogram buckets in LanceDBOperationMetrics
+ */
+#define LANCEDB_LATENCY_BUCKETS 24
+
+/**
+ * Metrics of a single operation
+ */
+typedef struct {
+    unsigned long long calls;        // Completed calls
+    unsigned long long errors;       // Calls that returned an error
+    unsigned long long total_nanos;  // Sum of call latencies
+    unsigned long long max_nanos;    // Latency of the slowest call
+    unsigned long long latency_buckets[LANCEDB_LATENCY_BUCKETS]; // Bucket i counts calls under 2^i microseconds, the last bucket all slower calls
+} LanceDBOperationMetrics;
+
+/**
+ * Metrics of data exported through the Arrow C ABI
+ */
+typedef struct {
+    unsigned long long batches;  // Record batches exported
+    unsigned long long bytes;    // Memory size of the exported batches
+} LanceDBExportMetrics;
+
+/**
+ * Finished operation passed to the span callback
+ */
+typedef struct {
+    const char* name;                     // Operation name, e.g. "table_add"
+    unsigned long long start_unix_nanos;  // Start time in nanoseconds since the Unix epoch
+    unsigned long long duration_nanos;    // Duration of the operation
+    int error;                            // 1 if the operation returned an error, 0 otherwise
+} LanceDBSpan;
+
+/**
+ * Callback invoked for every finished operation
+ *
+ * @param span - finished operation, only valid during the call
+ * @param user_data - opaque pointer passed to lancedb_metrics_set_span_callback
+ *
+ * The callback runs on the thread that finished the operation: the calling thread for
+ * blocking functions and a runtime thread for asynchronous operations. It must not block
+ * and must not call back into LanceDB. Mapping spans to OpenTelemetry spans is a matter
+ * of creating a span with the given name, start time and duration.
+ */
+typedef void (*LanceDBSpanCallback)(const LanceDBSpan* span, void* user_data);
+
+/**
+ * Get the metrics of an operation
+ *
+ * @param name - operation name, the C function name without the "lancedb_" prefix,
+ *               e.g. "table_add", "vector_query_execute" or "query_execute_async"
+ * @param metrics_out - pointer to receive the metrics
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * Metrics are process-wide and cover all connections. Operations that never ran report
+ * zeroed metrics. Reading batches of a query result is recorded as
+ * "query_result_next_batch", or as "query_result_stream_next" per batch when the result
+ * is streamed through lancedb_query_result_to_arrow_stream().
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_metrics_operation(
+    const char* name,
+    LanceDBOperationMetrics* metrics_out,
+    char** error_message
+);
+
+/**
+ * Get the metrics of data exported through the Arrow C ABI
+ *
+ * @param metrics_out - pointer to receive the metrics
+ */
+void lancedb_metrics_exported(LanceDBExportMetrics* metrics_out);
+
+/**
+ * Get all metrics as a JSON document
+ *
+ * @param report_out - pointer to receive the JSON string
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * The report has the form
+ * {"operations":{"<name>":{"calls":..,"errors":..,"total_nanos":..,"max_nanos":..,
+ * "latency_buckets":[..]},...},"exported":{"batches":..,"bytes":..}}.
+ * The caller must free the report with lancedb_free_string().
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_metrics_report(
+    char** report_out,
+    char** error_message
+);
+
+/**
+ * Reset all metrics to zero
+ */
+void lancedb_metrics_reset(void);
+
+/**
+ * Register the callback invoked for every finished operation
+ *
+ * @param callback - span callback (NULL to remove the current callback)
+ * @param user_data - opaque pointer passed to the callback
+ *
+ * The previous callback may still be invoked by operations finishing concurrently with
+ * this call, so its user data must outlive them.
+ */
+void lancedb_metrics_set_span_callback(
+    LanceDBSpanCallback callback,
+    void* user_data
+);
+
 /**
  * Create a ConnectBuilder for the given URI
  *
@@ -235,9 +566,31 @@ LanceDBConnectBuilder* lancedb_connect(const char* uri);
  *
  * On success, the builder is consumed by this function and must not be used after calling.
  * The returned connection must be freed with lancedb_connection_free().
+ * Use lancedb_connect_builder_try_execute() to learn why a connection failed.
  */
 LanceDBConnection* lancedb_connect_builder_execute(LanceDBConnectBuilder* builder);
 
+/**
+ * Execute the connection and report why it failed
+ *
+ * @param builder - pointer to LanceDBConnectBuilder returned from lancedb_connect()
+ * @param connection_out - pointer to receive the connection
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * The builder is consumed by this function and must not be used after calling.
+ * Fails if the database cannot be opened or the object store session cannot be set up,
+ * e.g. because the disk cache directory cannot be created.
+ * The returned connection must be freed with lancedb_connection_free().
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_connect_builder_try_execute(
+    LanceDBConnectBuilder* builder,
+    LanceDBConnection** connection_out,
+    char** error_message
+);
+
 
 /**
  * Set an option for the storage layer
@@ -253,6 +606,137 @@ LanceDBConnection* lancedb_connect_builder_execute(LanceDBConnectBuilder* builde
  */
 LanceDBConnectBuilder* lancedb_connect_builder_storage_option(LanceDBConnectBuilder* builder, const char* key, const char* value);
 
+/**
+ * Set the size of the index cache
+ * @param builder - pointer to LanceDBConnectBuilder returned from lancedb_connect()
+ * @param size_bytes - capacity of the index cache in bytes
+ * @return Non-null pointer to LanceDBConnectBuilder on success, NULL on failure
+ *
+ * The builder is consumed by this function and must not be used after calling.
+ *
+ * The index cache holds loaded index partitions of all tables opened through the connection.
+ * Size it to fit the working set of the indices, otherwise queries keep re-reading
+ * partitions from storage. Defaults to the Lance default (6 GiB).
+ */
+LanceDBConnectBuilder* lancedb_connect_builder_index_cache_size(LanceDBConnectBuilder* builder, size_t size_bytes);
+
+/**
+ * Set the size of the metadata cache
+ * @param builder - pointer to LanceDBConnectBuilder returned from lancedb_connect()
+ * @param size_bytes - capacity of the metadata cache in bytes
+ * @return Non-null pointer to LanceDBConnectBuilder on success, NULL on failure
+ *
+ * The builder is consumed by this function and must not be used after calling.
+ *
+ * The metadata cache holds manifests, fragment metadata and file metadata of all tables
+ * opened through the connection. Defaults to the Lance default (1 GiB).
+ */
+LanceDBConnectBuilder* lancedb_connect_builder_metadata_cache_size(LanceDBConnectBuilder* builder, size_t size_bytes);
+
+/**
+ * Set how often tables check for updates by other writers
+ * @param builder - pointer to LanceDBConnectBuilder returned from lancedb_connect()
+ * @param interval_ms - interval in milliseconds (0 = check on every read)
+ * @return Non-null pointer to LanceDBConnectBuilder on success, NULL on failure
+ *
+ * The builder is consumed by this function and must not be used after calling.
+ *
+ * By default tables never check for updates made through other connections or processes
+ * and only see them after being reopened.
+ */
+LanceDBConnectBuilder* lancedb_connect_builder_read_consistency_interval(LanceDBConnectBuilder* builder, unsigned long long interval_ms);
+
+/**
+ * Set the number of open table handles kept by the connection
+ * @param builder - pointer to LanceDBConnectBuilder returned from lancedb_connect()
+ * @param capacity - maximum number of cached table handles (0 = no cache)
+ * @return Non-null pointer to LanceDBConnectBuilder on success, NULL on failure
+ *
+ * The builder is consumed by this function and must not be used after calling.
+ *
+ * With a table cache, lancedb_connection_open_table() returns a handle sharing the state of
+ * a recently opened table instead of opening it again, and the least recently used table is
+ * evicted when the cache is full. Dropping or renaming a table through the connection
+ * evicts it. Disabled by default.
+ */
+LanceDBConnectBuilder* lancedb_connect_builder_table_cache_size(LanceDBConnectBuilder* builder, size_t capacity);
+
+/**
+ * Enable coalescing of concurrent vector queries
+ * @param builder - pointer to LanceDBConnectBuilder returned from lancedb_connect()
+ * @param window_us - time in microseconds a query waits for concurrent queries (0 = disabled)
+ * @param max_batch_size - maximum number of distinct query vectors per batch (0 = default of 64)
+ * @return Non-null pointer to LanceDBConnectBuilder on success, NULL on failure
+ *
+ * The builder is consumed by this function and must not be used after calling.
+ *
+ * Vector queries against the same table version with the same parameters (column, limit,
+ * filter, nprobes, ...) issued within the window run together as a single multi-vector
+ * query, and identical query vectors are searched only once. Each caller still receives a
+ * result of its own, identical to running its query alone. A batch starts early once it
+ * reaches max_batch_size. Coalescing trades up to window_us of latency for throughput under
+ * bursty load and needs no change to the callers. Hybrid, reranked and multivector queries
+ * are never coalesced. Disabled by default.
+ */
+LanceDBConnectBuilder* lancedb_connect_builder_query_coalescing(
+    LanceDBConnectBuilder* builder,
+    unsigned long long window_us,
+    size_t max_batch_size
+);
+
+/**
+ * Initialize an object store configuration with defaults
+ *
+ * @param config - pointer to LanceDBObjectStoreConfig
+ */
+void lancedb_object_store_config_init(LanceDBObjectStoreConfig* config);
+
+/**
+ * Tune the object stores of the connection and enable a local disk cache
+ * @param builder - pointer to LanceDBConnectBuilder returned from lancedb_connect()
+ * @param config - pointer to LanceDBObjectStoreConfig or NULL for defaults
+ * @return Non-null pointer to LanceDBConnectBuilder on success, NULL on failure
+ *
+ * The builder is consumed by this function and must not be used after calling.
+ *
+ * Fields left at 0 keep the Lance defaults. Timeouts and retries apply to every store and
+ * are set as storage options, so a later lancedb_connect_builder_storage_option() with the
+ * same key ("timeout", "connect_timeout", "client_max_retries", "client_retry_timeout")
+ * overrides them. Concurrency, block size and request size apply to remote stores (S3,
+ * GCS, Azure, OSS): a larger block size merges more nearby reads into one request, which
+ * suits high-latency stores. With disk_cache_path and disk_cache_bytes set, byte ranges
+ * read from immutable data, index and deletion files are kept in a directory created below
+ * disk_cache_path and reused by later reads; the least recently used ranges are evicted
+ * above disk_cache_bytes. The directory is removed when the connection is closed.
+ * Connecting fails if the directory cannot be created.
+ */
+LanceDBConnectBuilder* lancedb_connect_builder_object_store_config(
+    LanceDBConnectBuilder* builder,
+    const LanceDBObjectStoreConfig* config
+);
+
+/**
+ * Limit the memory held by query results and ingested batches of the connection
+ * @param builder - pointer to LanceDBConnectBuilder returned from lancedb_connect()
+ * @param limit_bytes - maximum tracked bytes (0 = unlimited)
+ * @return Non-null pointer to LanceDBConnectBuilder on success, NULL on failure
+ *
+ * The builder is consumed by this function and must not be used after calling.
+ *
+ * Every batch of a query result and every batch read from a reader passed to table
+ * creation, add, merge insert or a bulk loader is charged to the connection until its
+ * buffers are freed, including arrays exported to the caller until they are released.
+ * A batch is charged for the bytes its arrays reference, so slices of a larger batch are
+ * not charged for the parts of the shared buffers they do not cover. A batch that would take the total above limit_bytes fails its operation with an error
+ * instead of growing the process further: with a limit, lancedb_query_result_to_arrow()
+ * fails for results larger than the limit, while streaming the result with
+ * lancedb_query_result_next_batch() or an Arrow C stream and releasing each batch keeps
+ * usage bounded. Memory Lance allocates internally to execute queries, write files or
+ * build indices is not tracked. A limit_bytes of 0 disables both the limit and the
+ * tracking, so lancedb_connection_memory_stats() reports no usage for such connections.
+ */
+LanceDBConnectBuilder* lancedb_connect_builder_memory_limit(LanceDBConnectBuilder* builder, size_t limit_bytes);
+
 /**
  * Free a ConnectBuilder
  *
@@ -273,6 +757,26 @@ void lancedb_connect_builder_free(LanceDBConnectBuilder* builder);
  */
 const char* lancedb_connection_uri(const LanceDBConnection* connection);
 
+/**
+ * Get the memory usage of the connection
+ *
+ * @param connection - pointer to LanceDBConnection
+ * @param stats_out - pointer to receive the memory usage
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * Reports the bytes of query results and ingested batches currently alive and the peak
+ * since the connection was created, as tracked for lancedb_connect_builder_memory_limit().
+ * Connections without a memory limit do not track usage and report zero bytes.
+ * If error_message is provided and an error occurs, the caller must free the error message
+ * with lancedb_free_string().
+ */
+LanceDBError lancedb_connection_memory_stats(
+    const LanceDBConnection* connection,
+    LanceDBMemoryStats* stats_out,
+    char** error_message
+);
+
 /**
  * Get table names from the connection
  *
@@ -583,59 +1087,403 @@ LanceDBError lancedb_table_arrow_schema(
 unsigned long long lancedb_table_version(const LanceDBTable* table);
 
 /**
- * Count rows in table
+ * Check out a read-only handle of the table pinned to a version
  *
  * @param table - pointer to LanceDBTable
- * @return Number of rows in table on success, 0 on failure (or empty table)
+ * @param version - table version to pin, e.g. from lancedb_table_version()
+ * @param table_out - pointer to receive the pinned table, freed with lancedb_table_free()
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * The pinned table is a stable snapshot for readers while writers keep committing through
+ * other handles: queries, counts and fragment listings always see the given version and
+ * never reload the table, and writes through it fail. It is opened through the table's
+ * connection and shares the connection's index and metadata caches, so pinning a recent
+ * version usually loads nothing from storage. The table itself is left unchanged.
+ * If error_message is provided and an error occurs, the caller must free the error message
+ * with lancedb_free_string().
  */
-unsigned long long lancedb_table_count_rows(const LanceDBTable* table);
+LanceDBError lancedb_table_checkout(
+    const LanceDBTable* table,
+    unsigned long long version,
+    LanceDBTable** table_out,
+    char** error_message
+);
 
 /**
- * Add data to table using Arrow RecordBatchReader
+ * Get table version and schema from the table's snapshot cache
  *
  * @param table - pointer to LanceDBTable
- * @param reader - pointer to LanceDBRecordBatchReader
+ * @param max_staleness_ms - maximum age of a cached snapshot in milliseconds
+ *                           (-1 = the connection's read consistency interval, 0 = always refresh)
+ * @param version_out - optional pointer to receive the table version (NULL to ignore)
+ * @param schema_out - optional pointer to receive the Arrow schema (NULL to ignore)
  * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
  * @return Error code indicating success or failure
  *
- * This function takes ownership of the reader and frees it automatically.
- * Do NOT call lancedb_record_batch_reader_free() after calling this function.
+ * Unlike lancedb_table_version() and lancedb_table_arrow_schema(), a fresh enough cached
+ * snapshot is returned from memory without touching storage. The snapshot is shared by all
+ * handles of the table served from the connection's table cache, and is dropped by every
+ * write made through them. Without a read consistency interval on the connection, passing
+ * -1 keeps the snapshot until the next such write.
+ * Caller must free the schema with lancedb_free_arrow_schema().
  * If error_message is provided and an error occurs, the caller must free
  * the error message with lancedb_free_string().
  */
-LanceDBError lancedb_table_add(
+LanceDBError lancedb_table_snapshot(
     const LanceDBTable* table,
-    LanceDBRecordBatchReader* reader,
+    long long max_staleness_ms,
+    unsigned long long* version_out,
+    FFI_ArrowSchema** schema_out,
     char** error_message
 );
 
 /**
- * Merge insert data into table (upsert operation)
+ * List the fragments of a table version
  *
  * @param table - pointer to LanceDBTable
- * @param data - pointer to LanceDBRecordBatchReader containing data to merge
- * @param on_columns - array of column names to join on (typically key/id columns)
- * @param num_columns - number of columns in the on_columns array
- * @param config - pointer to LanceDBMergeInsertConfig for operation behavior (NULL for defaults)
+ * @param version - table version from lancedb_table_version() (0 = current version)
+ * @param fragments_out - pointer to receive the array of fragments
+ * @param count_out - pointer to receive the number of fragments
  * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
  * @return Error code indicating success or failure
  *
- * This function performs an upsert operation by joining on the specified columns.
- * New records are inserted, existing records can be updated based on configuration.
- * This function takes ownership of the reader and frees it automatically.
- * Do NOT call lancedb_record_batch_reader_free() after calling this function.
+ * Fragments hold disjoint sets of rows. To distribute a scan, pin a version, split
+ * its fragment IDs among workers and restrict each worker's query to its share with
+ * lancedb_query_fragments() using the same version. Only local tables are supported.
+ * The caller must free the array with lancedb_free_fragment_list().
  * If error_message is provided and an error occurs, the caller must free
  * the error message with lancedb_free_string().
  */
-LanceDBError lancedb_table_merge_insert(
+LanceDBError lancedb_table_list_fragments(
     const LanceDBTable* table,
-    LanceDBRecordBatchReader* data,
-    const char* const* on_columns,
-    size_t num_columns,
+    unsigned long long version,
+    LanceDBFragmentInfo** fragments_out,
+    size_t* count_out,
+    char** error_message
+);
+
+/**
+ * Free fragment array returned by lancedb_table_list_fragments
+ *
+ * @param fragments - array returned by lancedb_table_list_fragments (NULL is ignored)
+ */
+void lancedb_free_fragment_list(LanceDBFragmentInfo* fragments);
+
+/**
+ * Count rows in table
+ *
+ * @param table - pointer to LanceDBTable
+ * @return Number of rows in table on success, 0 on failure (or empty table)
+ *
+ * Use lancedb_table_count_rows_filtered() to tell an empty table from a failure.
+ */
+unsigned long long lancedb_table_count_rows(const LanceDBTable* table);
+
+/**
+ * Count rows in table matching a filter
+ *
+ * @param table - pointer to LanceDBTable
+ * @param filter - SQL filter expression, e.g. "tenant = 'acme'" (NULL to count all rows)
+ * @param max_staleness_ms - maximum age of a cached count in milliseconds
+ *                           (0 = always count, -1 = the connection's read consistency interval)
+ * @param count_out - pointer to receive the row count
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * Counting all rows only reads the row counts of the fragments in the table manifest.
+ * A filtered count scans just the filter columns, and uses scalar indices on them when
+ * available. Counts are cached per filter with the table snapshot (see
+ * lancedb_table_snapshot()), so a positive max_staleness_ms serves repeated counts from
+ * memory; every write made through the bindings drops the cached counts.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_count_rows_filtered(
+    const LanceDBTable* table,
+    const char* filter,
+    long long max_staleness_ms,
+    unsigned long long* count_out,
+    char** error_message
+);
+
+/**
+ * Count rows in table from manifest statistics only
+ *
+ * @param table - pointer to LanceDBTable
+ * @param count_out - pointer to receive the row count
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * Sums the physical rows of all fragments minus the deletions recorded in the manifest,
+ * without scanning or reading deletion files. The count is exact for tables written by
+ * current Lance versions; it is approximate only in that it reflects the handle's
+ * current version, which may lag behind other writers by the read consistency interval.
+ * There is no approximate filtered count: use lancedb_table_count_rows_filtered() with a
+ * positive max_staleness_ms to serve repeated filtered counts from memory.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_count_rows_approx(
+    const LanceDBTable* table,
+    unsigned long long* count_out,
+    char** error_message
+);
+
+/**
+ * Add data to table using Arrow RecordBatchReader
+ *
+ * @param table - pointer to LanceDBTable
+ * @param reader - pointer to LanceDBRecordBatchReader
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * This function takes ownership of the reader and frees it automatically.
+ * Do NOT call lancedb_record_batch_reader_free() after calling this function.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_add(
+    const LanceDBTable* table,
+    LanceDBRecordBatchReader* reader,
+    char** error_message
+);
+
+/**
+ * Initialize a write configuration with the default data file layout
+ *
+ * @param config - pointer to LanceDBWriteConfig
+ */
+void lancedb_write_config_init(LanceDBWriteConfig* config);
+
+/**
+ * Add data to table with write configuration
+ *
+ * @param table - pointer to LanceDBTable
+ * @param reader - pointer to LanceDBRecordBatchReader
+ * @param config - pointer to LanceDBWriteConfig for data file layout (NULL for defaults)
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * This function takes ownership of the reader and frees it automatically.
+ * Do NOT call lancedb_record_batch_reader_free() after calling this function.
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_add_with_config(
+    const LanceDBTable* table,
+    LanceDBRecordBatchReader* reader,
+    const LanceDBWriteConfig* config,
+    char** error_message
+);
+
+/**
+ * Create a bulk load for a table
+ *
+ * A bulk load collects any number of readers and writes them with a single
+ * commit, so the whole load becomes visible as one new table version.
+ *
+ * @param table - pointer to LanceDBTable
+ * @param config - pointer to LanceDBWriteConfig for data file layout (NULL for defaults)
+ * @return Pointer to LanceDBBulkLoader on success, NULL on failure (including a config
+ *         whose struct_size is not set)
+ *         Commit with lancedb_bulk_loader_commit() or discard with lancedb_bulk_loader_free()
+ */
+LanceDBBulkLoader* lancedb_table_bulk_load_new(
+    const LanceDBTable* table,
+    const LanceDBWriteConfig* config
+);
+
+/**
+ * Queue a reader for a bulk load
+ *
+ * Safe to call concurrently from several threads. All readers must have the
+ * same schema. No data is read until the bulk load is committed.
+ *
+ * @param loader - pointer to LanceDBBulkLoader
+ * @param reader - pointer to LanceDBRecordBatchReader
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * On success this function takes ownership of the reader.
+ * Do NOT call lancedb_record_batch_reader_free() after a successful call.
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_bulk_loader_add(
+    const LanceDBBulkLoader* loader,
+    LanceDBRecordBatchReader* reader,
+    char** error_message
+);
+
+/**
+ * Write all queued readers and commit them as a single table version
+ *
+ * @param loader - pointer to LanceDBBulkLoader (consumed)
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure; nothing is committed on failure
+ *
+ * The readers are written concurrently on the LanceDB runtime, each into its own
+ * fragments, and all fragments are committed together in one append. Fails with
+ * LANCEDB_NOT_SUPPORTED for tables pinned with lancedb_table_checkout().
+ * This function takes ownership of the loader and frees it automatically.
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_bulk_loader_commit(
+    LanceDBBulkLoader* loader,
+    char** error_message
+);
+
+/**
+ * Free a bulk load without committing it
+ *
+ * @param loader - pointer to LanceDBBulkLoader
+ */
+void lancedb_bulk_loader_free(LanceDBBulkLoader* loader);
+
+/**
+ * Initialize a merge insert configuration with the default upsert behavior
+ *
+ * @param config - pointer to LanceDBMergeInsertConfig
+ */
+void lancedb_merge_insert_config_init(LanceDBMergeInsertConfig* config);
+
+/**
+ * Merge insert data into table (upsert operation)
+ *
+ * @param table - pointer to LanceDBTable
+ * @param data - pointer to LanceDBRecordBatchReader containing data to merge
+ * @param on_columns - array of column names to join on (typically key/id columns)
+ * @param num_columns - number of columns in the on_columns array
+ * @param config - pointer to LanceDBMergeInsertConfig for operation behavior (NULL for defaults)
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * This function performs an upsert operation by joining on the specified columns.
+ * New records are inserted, existing records can be updated based on configuration.
+ * This function takes ownership of the reader and frees it automatically.
+ * Do NOT call lancedb_record_batch_reader_free() after calling this function.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_merge_insert(
+    const LanceDBTable* table,
+    LanceDBRecordBatchReader* data,
+    const char* const* on_columns,
+    size_t num_columns,
     const LanceDBMergeInsertConfig* config,
     char** error_message
 );
 
+/**
+ * Add data to table asynchronously
+ *
+ * @param table - pointer to LanceDBTable
+ * @param reader - pointer to LanceDBRecordBatchReader (consumed by this function)
+ * @param callback - optional completion callback (NULL to only poll or wait)
+ * @param user_data - opaque pointer passed to the callback
+ * @return Pointer to LanceDBFuture on success, NULL on invalid arguments
+ *         Resolve it with lancedb_future_get() or free it with lancedb_future_free()
+ *
+ * Same as lancedb_table_add(), but runs on the shared LanceDB runtime without blocking
+ * the calling thread. The table handle may be freed while the operation is running.
+ */
+LanceDBFuture* lancedb_table_add_async(
+    const LanceDBTable* table,
+    LanceDBRecordBatchReader* reader,
+    LanceDBCompletionCallback callback,
+    void* user_data
+);
+
+/**
+ * Merge insert data into table asynchronously
+ *
+ * @param table - pointer to LanceDBTable
+ * @param data - pointer to LanceDBRecordBatchReader containing data to merge
+ * @param on_columns - array of column names to join on (typically key/id columns)
+ * @param num_columns - number of columns in the on_columns array
+ * @param config - pointer to LanceDBMergeInsertConfig for operation behavior (NULL for defaults)
+ * @param callback - optional completion callback (NULL to only poll or wait)
+ * @param user_data - opaque pointer passed to the callback
+ * @return Pointer to LanceDBFuture on success, NULL on invalid arguments
+ *         Resolve it with lancedb_future_get() or free it with lancedb_future_free()
+ *
+ * Same as lancedb_table_merge_insert(), but runs on the shared LanceDB runtime without
+ * blocking the calling thread. The reader is consumed unless NULL is returned.
+ */
+LanceDBFuture* lancedb_table_merge_insert_async(
+    const LanceDBTable* table,
+    LanceDBRecordBatchReader* data,
+    const char* const* on_columns,
+    size_t num_columns,
+    const LanceDBMergeInsertConfig* config,
+    LanceDBCompletionCallback callback,
+    void* user_data
+);
+
+/**
+ * Check whether an asynchronous operation has finished
+ *
+ * @param future - pointer to LanceDBFuture
+ * @return 1 if the result is available, 0 otherwise
+ */
+int lancedb_future_is_ready(const LanceDBFuture* future);
+
+/**
+ * Get the status of an asynchronous operation without a result value
+ *
+ * @param future - pointer to LanceDBFuture from lancedb_table_add_async() or
+ *                 lancedb_table_merge_insert_async() (consumed by this function)
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code of the finished operation
+ *
+ * Blocks until the operation finishes if it is not ready yet. Called from a LanceDB runtime
+ * thread, e.g. from a completion callback, on a future that is not ready, it fails with
+ * LANCEDB_RUNTIME instead of blocking and cancels the operation.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_future_get(
+    LanceDBFuture* future,
+    char** error_message
+);
+
+/**
+ * Get the result of an asynchronous query
+ *
+ * @param future - pointer to LanceDBFuture from lancedb_query_execute_async() or
+ *                 lancedb_vector_query_execute_async() (consumed by this function)
+ * @param result_out - pointer to receive the query result
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code of the finished query
+ *         Caller must free the result with lancedb_query_result_free()
+ *
+ * Blocks until the query finishes if it is not ready yet. Called from a LanceDB runtime
+ * thread, e.g. from a completion callback, on a future that is not ready, it fails with
+ * LANCEDB_RUNTIME instead of blocking and cancels the operation.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_future_get_query_result(
+    LanceDBFuture* future,
+    LanceDBQueryResult** result_out,
+    char** error_message
+);
+
+/**
+ * Free a future
+ *
+ * @param future - pointer to LanceDBFuture
+ *
+ * If the operation is still running it is cancelled. Its callback is still invoked once
+ * from a runtime thread, after cancellation, so user data may be released there.
+ */
+void lancedb_future_free(LanceDBFuture* future);
+
 /**
  * Delete rows from table based on predicate
  *
@@ -653,6 +1501,47 @@ LanceDBError lancedb_table_delete(
     char** error_message
 );
 
+/**
+ * Cleanup old versions of the table
+ *
+ * @param table - pointer to LanceDBTable
+ * @param older_than_days - remove versions older than this number of days
+ * @param delete_unverified - also delete files of unfinished writes younger than 7 days
+ *                            (1 = true, 0 = false)
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * Removes the manifests of old versions and the data and index files that are no longer
+ * referenced by any remaining version, which keeps listing and manifest loads fast. The
+ * latest version and tagged versions are always kept. Only set delete_unverified when no
+ * other process is writing to the table.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_cleanup_old_versions(
+    const LanceDBTable* table,
+    unsigned short older_than_days,
+    int delete_unverified,
+    char** error_message
+);
+
+/**
+ * Compact small files in the table
+ *
+ * @param table - pointer to LanceDBTable
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * Rewrites small fragments into larger ones and materializes deleted rows. Indices are
+ * remapped to the new fragments.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_compact_files(
+    const LanceDBTable* table,
+    char** error_message
+);
+
 /**
  * Create a new query for the given table
  *
@@ -677,6 +1566,74 @@ LanceDBVectorQuery* lancedb_vector_query_new(
     size_t dimension
 );
 
+/**
+ * Create a vector query from table with multiple query vectors
+ *
+ * All query vectors are searched by a single query. When num_queries > 1 the
+ * results carry a "query_index" column (int32) with the row of the query vector
+ * each result belongs to, and limit/offset apply to each query vector.
+ *
+ * @param table - pointer to LanceDBTable
+ * @param vectors - row-major matrix of num_queries x dimension floats
+ * @param num_queries - number of query vectors (rows)
+ * @param dimension - dimension of each vector
+ * @return Pointer to LanceDBVectorQuery on success, NULL on failure
+ *         Caller must free with lancedb_vector_query_free()
+ */
+LanceDBVectorQuery* lancedb_vector_query_new_batch(
+    const LanceDBTable* table,
+    const float* vectors,
+    size_t num_queries,
+    size_t dimension
+);
+
+/**
+ * Create a multivector query from table with the vectors of one query
+ *
+ * Searches a multivector column (a list of fixed size vectors per row, e.g.
+ * late-interaction token embeddings) with all given vectors as a single query.
+ * Rows are scored by max-sim: for each query vector the best matching vector of
+ * the row, summed over the query vectors. The results carry no "query_index" column.
+ * Multivector columns only support the cosine distance.
+ *
+ * @param table - pointer to LanceDBTable
+ * @param vectors - row-major matrix of num_vectors x dimension floats
+ * @param num_vectors - number of vectors in the query (rows)
+ * @param dimension - dimension of each vector
+ * @return Pointer to LanceDBVectorQuery on success, NULL on failure
+ *         Caller must free with lancedb_vector_query_free()
+ */
+LanceDBVectorQuery* lancedb_vector_query_new_multivector(
+    const LanceDBTable* table,
+    const float* vectors,
+    size_t num_vectors,
+    size_t dimension
+);
+
+/**
+ * Create a vector query from table with query vectors of the given element type
+ *
+ * The vectors are copied once into an Arrow buffer, so the buffer can be released
+ * after the call. Floating point query vectors of a different type than the vector
+ * column are cast to the column type. Use LANCEDB_VECTOR_UINT8 with
+ * LANCEDB_DISTANCE_HAMMING for binary vector columns.
+ *
+ * @param table - pointer to LanceDBTable
+ * @param vectors - row-major matrix of num_queries x dimension elements of element_type
+ * @param element_type - element type of the vectors
+ * @param num_queries - number of query vectors (rows)
+ * @param dimension - number of elements of each vector
+ * @return Pointer to LanceDBVectorQuery on success, NULL on failure
+ *         Caller must free with lancedb_vector_query_free()
+ */
+LanceDBVectorQuery* lancedb_vector_query_new_typed(
+    const LanceDBTable* table,
+    const void* vectors,
+    LanceDBVectorElementType element_type,
+    size_t num_queries,
+    size_t dimension
+);
+
 /**
  * Set limit for query
  *
@@ -747,6 +1704,71 @@ LanceDBError lancedb_query_where_filter(
     char** error_message
 );
 
+/**
+ * Turn query into a full-text search
+ *
+ * Requires an FTS index on the searched columns (see lancedb_table_create_fts_index()).
+ * Results are ordered by BM25 relevance and carry a "_score" column.
+ *
+ * @param query - pointer to LanceDBQuery
+ * @param text - search terms
+ * @param columns - array of column names to search (NULL to search all FTS indexed columns)
+ * @param num_columns - number of columns in the array
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_query_full_text_search(
+    LanceDBQuery* query,
+    const char* text,
+    const char* const* columns,
+    size_t num_columns,
+    char** error_message
+);
+
+/**
+ * Include the "_rowid" column in query results
+ *
+ * @param query - pointer to LanceDBQuery
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * Row IDs can be passed to lancedb_table_take_row_ids().
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_query_with_row_id(
+    LanceDBQuery* query,
+    char** error_message
+);
+
+/**
+ * Restrict query to fragments of a table version
+ *
+ * @param query - pointer to LanceDBQuery
+ * @param fragment_ids - array of fragment IDs from lancedb_table_list_fragments()
+ * @param num_fragments - number of fragment IDs in the array
+ * @param version - table version the fragment IDs belong to (0 = current version)
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure, LANCEDB_INVALID_INPUT if a
+ *         fragment does not exist in the version
+ *
+ * The query reads the pinned version even if the table changes meanwhile. Queries
+ * over disjoint fragment sets read disjoint rows; limit, offset, projection and filter
+ * apply to the selected fragments. Full-text search cannot be combined with fragments.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_query_fragments(
+    LanceDBQuery* query,
+    const unsigned long long* fragment_ids,
+    size_t num_fragments,
+    unsigned long long version,
+    char** error_message
+);
+
 /**
  * Set limit for vector query
  *
@@ -945,64 +1967,387 @@ LanceDBError lancedb_vector_query_refine_factor(
  * - ef = 100-200 → good balance for most use cases
  * - ef = 500+ → very high recall, slower queries
  *
- * Note: The ef parameter at query time is different from ef_construction used during
- * index building. Query-time ef controls search quality, while ef_construction controls
- * index quality.
+ * Note: The ef parameter at query time is different from ef_construction used during
+ * index building. Query-time ef controls search quality, while ef_construction controls
+ * index quality and is set with lancedb_table_create_vector_index_with_params().
+ *
+ * @param query - pointer to LanceDBVectorQuery
+ * @param ef - exploration factor for HNSW search (must be >= query limit)
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_vector_query_ef(
+    LanceDBVectorQuery* query,
+    size_t ef,
+    char** error_message
+);
+
+/**
+ * Apply the WHERE filter of vector query after the vector search
+ *
+ * By default the filter is applied before the search (prefilter), which always
+ * returns up to limit matching rows. A postfilter avoids evaluating the filter on
+ * the whole table, but can return fewer rows than the limit.
+ *
+ * @param query - pointer to LanceDBVectorQuery
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_vector_query_postfilter(
+    LanceDBVectorQuery* query,
+    char** error_message
+);
+
+/**
+ * Search only indexed data of vector query
+ *
+ * Rows added since the vector index was last updated are skipped instead of
+ * being searched exhaustively.
+ *
+ * @param query - pointer to LanceDBVectorQuery
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_vector_query_fast_search(
+    LanceDBVectorQuery* query,
+    char** error_message
+);
+
+/**
+ * Perform an exact (flat) search instead of using the vector index
+ *
+ * Combined with a selective prefilter only the distances of the matching rows are
+ * computed, which is faster than an index search when few rows match.
+ *
+ * @param query - pointer to LanceDBVectorQuery
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_vector_query_bypass_vector_index(
+    LanceDBVectorQuery* query,
+    char** error_message
+);
+
+/**
+ * Include the "_rowid" column in vector query results
+ *
+ * Combined with lancedb_vector_query_select() with zero columns, the results only
+ * carry "_distance" and "_rowid"; fetch further columns of the best rows with
+ * lancedb_table_take_row_ids().
+ *
+ * @param query - pointer to LanceDBVectorQuery
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_vector_query_with_row_id(
+    LanceDBVectorQuery* query,
+    char** error_message
+);
+
+/**
+ * Add a full-text search to vector query, making it a hybrid query
+ *
+ * The vector and full-text searches run as one query and their results are
+ * combined by the reranker (RRF unless set with lancedb_vector_query_rerank()).
+ * Results are ordered by a "_relevance_score" column.
+ *
+ * @param query - pointer to LanceDBVectorQuery
+ * @param text - search terms
+ * @param columns - array of column names to search (NULL to search all FTS indexed columns)
+ * @param num_columns - number of columns in the array
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_vector_query_full_text_search(
+    LanceDBVectorQuery* query,
+    const char* text,
+    const char* const* columns,
+    size_t num_columns,
+    char** error_message
+);
+
+/**
+ * Set reranker combining the results of a hybrid query
+ *
+ * @param query - pointer to LanceDBVectorQuery
+ * @param config - pointer to LanceDBRerankerConfig (NULL for default RRF)
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_vector_query_rerank(
+    LanceDBVectorQuery* query,
+    const LanceDBRerankerConfig* config,
+    char** error_message
+);
+
+/**
+ * Execute query and return streaming result
+ *
+ * @param query - pointer to LanceDBQuery (consumed by this function)
+ * @return Pointer to LanceDBQueryResult on success, NULL on failure
+ *         Caller must free with lancedb_query_result_free()
+ */
+LanceDBQueryResult* lancedb_query_execute(LanceDBQuery* query);
+
+/**
+ * Execute vector query and return streaming result
+ *
+ * @param query - pointer to LanceDBVectorQuery (consumed by this function)
+ * @return Pointer to LanceDBQueryResult on success, NULL on failure
+ *         Caller must free with lancedb_query_result_free()
+ */
+LanceDBQueryResult* lancedb_vector_query_execute(LanceDBVectorQuery* query);
+
+/**
+ * Get the execution plan of query without running it
+ *
+ * @param query - pointer to LanceDBQuery (not consumed)
+ * @param verbose - include details of each plan node (1 = true, 0 = false)
+ * @param plan_out - pointer to receive the plan as a string
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *         Caller must free the plan with lancedb_free_string()
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_query_explain_plan(
+    const LanceDBQuery* query,
+    int verbose,
+    char** plan_out,
+    char** error_message
+);
+
+/**
+ * Run query and get its execution plan annotated with runtime metrics
+ *
+ * The metrics of each plan node include the rows it produced, the time spent in
+ * it and, for scans, the I/O performed (e.g. partitions probed, rows scanned).
+ * The results themselves are discarded.
+ *
+ * @param query - pointer to LanceDBQuery (not consumed)
+ * @param plan_out - pointer to receive the annotated plan as a string
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *         Caller must free the plan with lancedb_free_string()
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_query_analyze_plan(
+    const LanceDBQuery* query,
+    char** plan_out,
+    char** error_message
+);
+
+/**
+ * Get the execution plan of vector query without running it
+ *
+ * @param query - pointer to LanceDBVectorQuery (not consumed)
+ * @param verbose - include details of each plan node (1 = true, 0 = false)
+ * @param plan_out - pointer to receive the plan as a string
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *         Caller must free the plan with lancedb_free_string()
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_vector_query_explain_plan(
+    const LanceDBVectorQuery* query,
+    int verbose,
+    char** plan_out,
+    char** error_message
+);
+
+/**
+ * Run vector query and get its execution plan annotated with runtime metrics
+ *
+ * Useful to tune nprobes, refine_factor and ef from the measured work of the
+ * index search. The results themselves are discarded.
+ *
+ * @param query - pointer to LanceDBVectorQuery (not consumed)
+ * @param plan_out - pointer to receive the annotated plan as a string
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *         Caller must free the plan with lancedb_free_string()
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_vector_query_analyze_plan(
+    const LanceDBVectorQuery* query,
+    char** plan_out,
+    char** error_message
+);
+
+/**
+ * Convert query result to Arrow RecordBatch arrays
+ *
+ * @param result - pointer to LanceDBQueryResult (consumed by this function)
+ * @param result_arrays - pointer to receive array of Arrow C ABI arrays
+ * @param result_schema - pointer to receive single Arrow C ABI schema
+ * @param count_out - pointer to receive number of result batches
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *         Caller must free arrays with lancedb_free_arrow_arrays() and schema with lancedb_free_arrow_schema()
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_query_result_to_arrow(
+    LanceDBQueryResult* result,
+    struct FFI_ArrowArray*** result_arrays,
+    struct FFI_ArrowSchema** result_schema,
+    size_t* count_out,
+    char** error_message
+);
+
+/**
+ * Get the schema of a query result
  *
- * @param query - pointer to LanceDBVectorQuery
- * @param ef - exploration factor for HNSW search (must be >= query limit)
+ * @param result - pointer to LanceDBQueryResult
+ * @param schema_out - pointer to receive the Arrow C ABI schema
  * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
  * @return Error code indicating success or failure
+ *         Caller must free the schema with lancedb_free_arrow_schema()
  *
+ * The result is not consumed and can still be read with lancedb_query_result_next_batch().
  * If error_message is provided and an error occurs, the caller must free
  * the error message with lancedb_free_string().
  */
-LanceDBError lancedb_vector_query_ef(
-    LanceDBVectorQuery* query,
-    size_t ef,
+LanceDBError lancedb_query_result_schema(
+    const LanceDBQueryResult* result,
+    struct FFI_ArrowSchema** schema_out,
     char** error_message
 );
 
 /**
- * Execute query and return streaming result
+ * Fetch the next batch from a query result
  *
- * @param query - pointer to LanceDBQuery (consumed by this function)
- * @return Pointer to LanceDBQueryResult on success, NULL on failure
- *         Caller must free with lancedb_query_result_free()
+ * @param result - pointer to LanceDBQueryResult
+ * @param array_out - pointer to receive the next Arrow C ABI array, set to NULL when the result is exhausted
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *         Caller must free each returned array with lancedb_free_arrow_array()
+ *
+ * Batches are produced on demand, so only one batch is held in memory at a time and
+ * processing can start before the whole query finishes. Use lancedb_query_result_schema()
+ * to get the schema shared by all batches. The result is not consumed and must still
+ * be freed with lancedb_query_result_free().
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
  */
-LanceDBQueryResult* lancedb_query_execute(LanceDBQuery* query);
+LanceDBError lancedb_query_result_next_batch(
+    LanceDBQueryResult* result,
+    struct FFI_ArrowArray** array_out,
+    char** error_message
+);
 
 /**
- * Execute vector query and return streaming result
+ * Fetch the next batches from a query result into caller-allocated arrays
  *
- * @param query - pointer to LanceDBVectorQuery (consumed by this function)
- * @return Pointer to LanceDBQueryResult on success, NULL on failure
- *         Caller must free with lancedb_query_result_free()
+ * @param result - pointer to LanceDBQueryResult
+ * @param arrays_out - caller-allocated array of capacity ArrowArray structures (Arrow C data interface)
+ * @param capacity - number of structures in arrays_out
+ * @param count_out - pointer to receive the number of batches written
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *         Caller must release each written array through its release callback
+ *
+ * Batches are moved into the caller's structures without copying their buffers and
+ * without a separate allocation per batch, so the same buffer can be reused across
+ * calls and queries. No schema is exported; get it once with lancedb_query_result_schema().
+ * Fewer than capacity batches are written only once the result is exhausted. The result
+ * is not consumed and must still be freed with lancedb_query_result_free().
+ * On error count_out is 0 and nothing needs releasing: batches fetched before the error
+ * are released by this function and their structures are left with a NULL release.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
  */
-LanceDBQueryResult* lancedb_vector_query_execute(LanceDBVectorQuery* query);
+LanceDBError lancedb_query_result_next_batches(
+    LanceDBQueryResult* result,
+    struct FFI_ArrowArray* arrays_out,
+    size_t capacity,
+    size_t* count_out,
+    char** error_message
+);
 
 /**
- * Convert query result to Arrow RecordBatch arrays
+ * Export query result as an Arrow C stream
  *
  * @param result - pointer to LanceDBQueryResult (consumed by this function)
- * @param result_arrays - pointer to receive array of Arrow C ABI arrays
- * @param result_schema - pointer to receive single Arrow C ABI schema
- * @param count_out - pointer to receive number of result batches
+ * @param stream_out - pointer to an uninitialized ArrowArrayStream structure to fill
  * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
  * @return Error code indicating success or failure
- *         Caller must free arrays with lancedb_free_arrow_arrays() and schema with lancedb_free_arrow_schema()
  *
+ * The stream pulls one batch at a time from the query result, and can be imported
+ * directly by Arrow implementations (e.g. arrow::ImportRecordBatchReader in Arrow C++).
+ * The caller owns the stream and must release it through its release callback.
  * If error_message is provided and an error occurs, the caller must free
  * the error message with lancedb_free_string().
  */
-LanceDBError lancedb_query_result_to_arrow(
+LanceDBError lancedb_query_result_to_arrow_stream(
     LanceDBQueryResult* result,
-    struct FFI_ArrowArray*** result_arrays,
-    struct FFI_ArrowSchema** result_schema,
-    size_t* count_out,
+    struct FFI_ArrowArrayStream* stream_out,
     char** error_message
 );
 
+/**
+ * Execute query asynchronously
+ *
+ * @param query - pointer to LanceDBQuery (consumed by this function)
+ * @param callback - optional completion callback (NULL to only poll or wait)
+ * @param user_data - opaque pointer passed to the callback
+ * @return Pointer to LanceDBFuture on success, NULL on failure
+ *         Resolve it with lancedb_future_get_query_result() or free it with lancedb_future_free()
+ *
+ * The query runs on the shared LanceDB runtime and does not block the calling thread.
+ */
+LanceDBFuture* lancedb_query_execute_async(
+    LanceDBQuery* query,
+    LanceDBCompletionCallback callback,
+    void* user_data
+);
+
+/**
+ * Execute vector query asynchronously
+ *
+ * @param query - pointer to LanceDBVectorQuery (consumed by this function)
+ * @param callback - optional completion callback (NULL to only poll or wait)
+ * @param user_data - opaque pointer passed to the callback
+ * @return Pointer to LanceDBFuture on success, NULL on failure
+ *         Resolve it with lancedb_future_get_query_result() or free it with lancedb_future_free()
+ *
+ * The query runs on the shared LanceDB runtime and does not block the calling thread.
+ */
+LanceDBFuture* lancedb_vector_query_execute_async(
+    LanceDBVectorQuery* query,
+    LanceDBCompletionCallback callback,
+    void* user_data
+);
+
 /**
  * Free a Query
  *
@@ -1054,6 +2399,112 @@ LanceDBError lancedb_table_nearest_to(
     char** error_message
 );
 
+/**
+ * Vector search for multiple query vectors with full result conversion
+ *
+ * When num_queries > 1 the results carry a "query_index" column (int32) with the
+ * row of the query vector each result belongs to.
+ *
+ * @param table - pointer to LanceDBTable
+ * @param vectors - row-major matrix of num_queries x dimension floats
+ * @param num_queries - number of query vectors (rows)
+ * @param dimension - dimension of each vector
+ * @param limit - maximum number of results to return for each query vector
+ * @param column - vector column name (NULL for default "vector" column)
+ * @param result_arrays - pointer to receive array of Arrow C ABI arrays
+ * @param result_schema - pointer to receive single Arrow C ABI schema (shared by all arrays)
+ * @param count_out - pointer to receive number of result batches
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *         Caller must free arrays with lancedb_free_arrow_arrays() and schema with lancedb_free_arrow_schema()
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_nearest_to_batch(
+    const LanceDBTable* table,
+    const float* vectors,
+    size_t num_queries,
+    size_t dimension,
+    size_t limit,
+    const char* column,
+    struct FFI_ArrowArray*** result_arrays,
+    struct FFI_ArrowSchema** result_schema,
+    size_t* count_out,
+    char** error_message
+);
+
+/**
+ * Vector search for query vectors of the given element type with full result conversion
+ *
+ * When num_queries > 1 the results carry a "query_index" column (int32) with the
+ * row of the query vector each result belongs to.
+ *
+ * @param table - pointer to LanceDBTable
+ * @param vectors - row-major matrix of num_queries x dimension elements of element_type
+ * @param element_type - element type of the vectors
+ * @param num_queries - number of query vectors (rows)
+ * @param dimension - number of elements of each vector
+ * @param limit - maximum number of results to return for each query vector
+ * @param column - vector column name (NULL for default "vector" column)
+ * @param result_arrays - pointer to receive array of Arrow C ABI arrays
+ * @param result_schema - pointer to receive single Arrow C ABI schema (shared by all arrays)
+ * @param count_out - pointer to receive number of result batches
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *         Caller must free arrays with lancedb_free_arrow_arrays() and schema with lancedb_free_arrow_schema()
+ *
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_nearest_to_typed(
+    const LanceDBTable* table,
+    const void* vectors,
+    LanceDBVectorElementType element_type,
+    size_t num_queries,
+    size_t dimension,
+    size_t limit,
+    const char* column,
+    struct FFI_ArrowArray*** result_arrays,
+    struct FFI_ArrowSchema** result_schema,
+    size_t* count_out,
+    char** error_message
+);
+
+/**
+ * Fetch rows by their row IDs
+ *
+ * @param table - pointer to LanceDBTable
+ * @param row_ids - array of "_rowid" values from a query with row IDs enabled
+ * @param num_row_ids - number of row IDs in the array
+ * @param columns - array of column names to fetch (NULL to fetch all columns)
+ * @param num_columns - number of columns in the array
+ * @param result_arrays - pointer to receive array of Arrow C ABI arrays
+ * @param result_schema - pointer to receive single Arrow C ABI schema (shared by all arrays)
+ * @param count_out - pointer to receive number of result batches
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *         Caller must free arrays with lancedb_free_arrow_arrays() and schema with lancedb_free_arrow_schema()
+ *
+ * Rows are read directly from their fragments, in the order of row_ids, without
+ * scanning or filtering the table. Use it as the second stage after a vector query
+ * that only projects "_rowid" and "_distance" (see lancedb_vector_query_with_row_id()).
+ * Row IDs stay valid until the rows are moved by compaction, updated or deleted.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_take_row_ids(
+    const LanceDBTable* table,
+    const unsigned long long* row_ids,
+    size_t num_row_ids,
+    const char* const* columns,
+    size_t num_columns,
+    struct FFI_ArrowArray*** result_arrays,
+    struct FFI_ArrowSchema** result_schema,
+    size_t* count_out,
+    char** error_message
+);
+
 /**
  * Create a RecordBatchReader from Arrow C ABI structures
  *
@@ -1072,6 +2523,25 @@ LanceDBRecordBatchReader* lancedb_record_batch_reader_from_arrow(
     const struct FFI_ArrowSchema* schema
 );
 
+/**
+ * Create a RecordBatchReader from an Arrow C stream
+ *
+ * Batches are pulled from the stream while the data is written, so passing the
+ * reader to lancedb_table_add() or lancedb_table_merge_insert() ingests the whole
+ * stream in a single commit without buffering it in memory.
+ *
+ * @param stream - pointer to an initialized ArrowArrayStream
+ * @return Pointer to LanceDBRecordBatchReader on success, NULL on failure
+ *
+ * This function consumes the stream according to Arrow C ABI specification,
+ * also on failure. It is marked released and the caller should NOT call the
+ * stream's release function. The caller is responsible for freeing the
+ * returned reader with lancedb_record_batch_reader_free().
+ */
+LanceDBRecordBatchReader* lancedb_record_batch_reader_from_arrow_stream(
+    struct FFI_ArrowArrayStream* stream
+);
+
 /**
  * Free RecordBatchReader
  *
@@ -1095,17 +2565,59 @@ void lancedb_free_arrow_schema(FFI_ArrowSchema* schema);
  * @param index_type - type of vector index to create
  * @param config - pointer to LanceDBVectorIndexConfig or NULL for defaults
  * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure, LANCEDB_NOT_SUPPORTED if the
+ *         requested accelerator is not available
+ *
+ * A GPU accelerator is never silently replaced by the CPU: if config->accelerator names
+ * a device this build cannot train on, no index is created and an error is returned.
+ * IVF_SQ stores 8-bit scalar-quantized vectors, IVF_RQ RaBitQ codes with 1 bit per
+ * dimension by default; combine them with lancedb_vector_query_refine_factor() to
+ * rerank candidates on the full vectors. Multivector columns are indexed with the
+ * same index types and require the cosine distance.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_create_vector_index(
+    const LanceDBTable* table,
+    const char* const* columns,
+    size_t num_columns,
+    LanceDBIndexType index_type,
+    const LanceDBVectorIndexConfig* config,
+    char** error_message
+);
+
+/**
+ * Initialize advanced vector index parameters with defaults
+ *
+ * @param params - pointer to LanceDBVectorIndexParams
+ */
+void lancedb_vector_index_params_init(LanceDBVectorIndexParams* params);
+
+/**
+ * Create a vector index on table columns with advanced build parameters
+ *
+ * @param table - pointer to LanceDBTable
+ * @param columns - array of null-terminated C strings containing column names
+ * @param num_columns - number of columns in the array
+ * @param index_type - type of vector index to create
+ * @param config - pointer to LanceDBVectorIndexConfig or NULL for defaults
+ * @param params - pointer to LanceDBVectorIndexParams or NULL for defaults
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
  * @return Error code indicating success or failure
  *
+ * Parameters that don't apply to index_type are ignored, e.g. m and ef_construction
+ * for IVF_PQ. Larger m and ef_construction improve recall at the cost of build time
+ * and index memory; num_bits = 4 halves the PQ code size at lower recall.
  * If error_message is provided and an error occurs, the caller must free
  * the error message with lancedb_free_string().
  */
-LanceDBError lancedb_table_create_vector_index(
+LanceDBError lancedb_table_create_vector_index_with_params(
     const LanceDBTable* table,
     const char* const* columns,
     size_t num_columns,
     LanceDBIndexType index_type,
     const LanceDBVectorIndexConfig* config,
+    const LanceDBVectorIndexParams* params,
     char** error_message
 );
 
@@ -1115,11 +2627,17 @@ LanceDBError lancedb_table_create_vector_index(
  * @param table - pointer to LanceDBTable
  * @param columns - array of null-terminated C strings containing column names
  * @param num_columns - number of columns in the array
- * @param index_type - type of scalar index to create
+ * @param index_type - LANCEDB_INDEX_BTREE, LANCEDB_INDEX_BITMAP, LANCEDB_INDEX_LABELLIST
+ *                     or LANCEDB_INDEX_AUTO to pick the kind from the column type
  * @param config - pointer to LanceDBScalarIndexConfig or NULL for defaults
  * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
  * @return Error code indicating success or failure
  *
+ * BTREE suits high-cardinality columns and range filters, BITMAP low-cardinality
+ * columns filtered by equality or IN, and LABELLIST list columns filtered with
+ * array_has_any() / array_has_all(). Filters set with lancedb_query_where_filter() or
+ * lancedb_vector_query_where_filter() that an index can answer show up as a
+ * "ScalarIndexQuery" node in lancedb_query_explain_plan() / lancedb_vector_query_explain_plan().
  * If error_message is provided and an error occurs, the caller must free
  * the error message with lancedb_free_string().
  */
@@ -1190,6 +2708,71 @@ LanceDBError lancedb_table_drop_index(
     char** error_message
 );
 
+/**
+ * Load an index into the index cache
+ *
+ * @param table - pointer to LanceDBTable
+ * @param index_name - null-terminated C string containing the index name
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * Call this at startup so the first queries using the index don't pay the cold-start I/O
+ * of loading it. The index cache must be large enough to hold the index, see
+ * lancedb_connect_builder_index_cache_size().
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_prewarm_index(
+    const LanceDBTable* table,
+    const char* index_name,
+    char** error_message
+);
+
+/**
+ * Get statistics of an index
+ *
+ * @param table - pointer to LanceDBTable
+ * @param index_name - null-terminated C string containing the index name
+ * @param stats_out - pointer to receive the index statistics
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure, LANCEDB_INDEX_NOT_FOUND if the
+ *         table has no index with that name
+ *
+ * Index names are the ones returned by lancedb_table_list_indices(). Rows counted
+ * in num_unindexed_rows are still found by queries, but by a flat scan next to the index.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_index_stats(
+    const LanceDBTable* table,
+    const char* index_name,
+    LanceDBIndexStats* stats_out,
+    char** error_message
+);
+
+/**
+ * Add the unindexed rows of a table to an existing index
+ *
+ * @param table - pointer to LanceDBTable
+ * @param index_name - null-terminated C string containing the index name
+ * @param num_indices_to_merge - number of existing deltas merged with the new rows
+ *                               (0 = write the new rows to a new delta)
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * Unlike rebuilding the index with lancedb_table_create_vector_index(), this reuses the
+ * trained model (IVF centroids, PQ codebooks) and only indexes the new rows, so its
+ * cost grows with the number of unindexed rows instead of the table size.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_table_update_index(
+    const LanceDBTable* table,
+    const char* index_name,
+    size_t num_indices_to_merge,
+    char** error_message
+);
+
 /**
  * Optimize table (rebuild indices and compact files)
  *
@@ -1207,6 +2790,67 @@ LanceDBError lancedb_table_optimize(
     char** error_message
 );
 
+/**
+ * Maintenance scheduler configuration
+ */
+typedef struct {
+    unsigned long long interval_ms;       // Time between two maintenance passes (0 = default 60000)
+    unsigned long long pause_ms;          // Pause after each maintenance operation (0 = none)
+    size_t compact_min_fragments;         // Compact a table once it has this many fragments (0 = never)
+    size_t optimize_min_unindexed_rows;   // Update indices once this many rows are unindexed (0 = never)
+    size_t cleanup_min_versions;          // Clean up old versions once a table has this many versions (0 = never)
+    unsigned short cleanup_older_than_days; // Age of the versions removed by cleanup
+} LanceDBMaintenanceConfig;
+
+/**
+ * Start a maintenance scheduler on the LanceDB runtime
+ *
+ * @param config - pointer to LanceDBMaintenanceConfig
+ * @return Non-null pointer to LanceDBMaintenanceScheduler on success, NULL on failure
+ *
+ * Every interval_ms the scheduler checks each of its tables and runs the due operations:
+ * lancedb_table_compact_files(), updating indices with rows added since they were built,
+ * and lancedb_table_cleanup_old_versions(). Operations run one at a time with pause_ms in
+ * between, so maintenance never competes with foreground queries for more than one
+ * runtime worker. Failed operations are retried in the next pass; they are recorded in the
+ * metrics as "maintenance_compact_files", "maintenance_optimize_indices" and
+ * "maintenance_cleanup_old_versions" (see lancedb_metrics_operation()).
+ * The scheduler must be freed with lancedb_maintenance_scheduler_free().
+ */
+LanceDBMaintenanceScheduler* lancedb_maintenance_scheduler_new(
+    const LanceDBMaintenanceConfig* config
+);
+
+/**
+ * Add a table to the tables maintained by the scheduler
+ *
+ * @param scheduler - pointer to LanceDBMaintenanceScheduler
+ * @param table - pointer to LanceDBTable
+ * @param error_message - optional pointer to receive detailed error message (NULL to ignore)
+ * @return Error code indicating success or failure
+ *
+ * The scheduler keeps its own handle of the table, so the table can be freed afterwards.
+ * If error_message is provided and an error occurs, the caller must free
+ * the error message with lancedb_free_string().
+ */
+LanceDBError lancedb_maintenance_scheduler_add_table(
+    const LanceDBMaintenanceScheduler* scheduler,
+    const LanceDBTable* table,
+    char** error_message
+);
+
+/**
+ * Stop and free a maintenance scheduler
+ *
+ * @param scheduler - pointer to LanceDBMaintenanceScheduler
+ *
+ * Blocks until a running maintenance operation has finished. Called from a runtime
+ * thread, such as a future callback, it returns immediately instead and the stopped
+ * scheduler finishes its running operation in the background.
+ * After calling this function, the scheduler pointer must not be used.
+ */
+void lancedb_maintenance_scheduler_free(LanceDBMaintenanceScheduler* scheduler);
+
 /**
  * Free index list array returned by lancedb_table_list_indices
  *
@@ -1215,6 +2859,13 @@ LanceDBError lancedb_table_optimize(
  */
 void lancedb_free_index_list(char** indices, size_t count);
 
+/**
+ * Free a single Arrow array returned by lancedb_query_result_next_batch
+ *
+ * @param array - Arrow C ABI array pointer
+ */
+void lancedb_free_arrow_array(struct FFI_ArrowArray* array);
+
 /**
  * Free Arrow arrays returned by vector search functions
  *
@@ -0,0 +1,479 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ * SPDX-FileCopyrightText: Copyright The LanceDB Authors
+ */
+
+/**
+ * Header-only C++20 wrapper of the LanceDB C API
+ *
+ * Handles are move-only types that free the underlying C object in their destructor.
+ * Failing calls throw lancedb::Error carrying the C error code; error strings are only
+ * allocated when a call fails. Query results are imported as arrow::RecordBatchReader
+ * through the Arrow C stream interface, so no batch is copied.
+ */
+
+#ifndef LANCEDB_HPP
+#define LANCEDB_HPP
+
+#include <arrow/api.h>
+#include <arrow/c/bridge.h>
+
+#include <atomic>
+#include <coroutine>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "lancedb.h"
+
+namespace lancedb {
+
+/**
+ * Error thrown by failing LanceDB calls
+ */
+class Error : public std::runtime_error {
+public:
+  Error(LanceDBError code, const std::string& message) : std::runtime_error(message), code_(code) {}
+
+  /** Error code returned by the C API */
+  LanceDBError code() const noexcept { return code_; }
+
+private:
+  LanceDBError code_;
+};
+
+namespace detail {
+
+// Throw for a failed call, taking ownership of its error message
+inline void check(LanceDBError code, char* error_message) {
+  if (code == LANCEDB_SUCCESS) {
+    return;
+  }
+  std::string message = error_message ? error_message : lancedb_error_to_message(code);
+  if (error_message) {
+    lancedb_free_string(error_message);
+  }
+  throw Error(code, message);
+}
+
+// Throw for a constructor returning NULL
+template <typename T>
+T* check_handle(T* handle, const char* what) {
+  if (handle == nullptr) {
+    throw Error(LANCEDB_INVALID_ARGUMENT, std::string("Failed to create ") + what);
+  }
+  return handle;
+}
+
+template <typename T, void (*Free)(T*)>
+struct Deleter {
+  void operator()(T* handle) const noexcept { Free(handle); }
+};
+
+// Move-only owner of a C handle
+template <typename T, void (*Free)(T*)>
+using Handle = std::unique_ptr<T, Deleter<T, Free>>;
+
+inline void check_arrow(const arrow::Status& status) {
+  if (!status.ok()) {
+    throw Error(LANCEDB_ARROW, status.ToString());
+  }
+}
+
+// Import a query result as a record batch reader; consumes the result
+inline std::shared_ptr<arrow::RecordBatchReader> import_result(LanceDBQueryResult* result) {
+  struct ArrowArrayStream c_stream;
+  char* error_message = nullptr;
+  check(lancedb_query_result_to_arrow_stream(
+      result, reinterpret_cast<FFI_ArrowArrayStream*>(&c_stream), &error_message), error_message);
+  auto reader = arrow::ImportRecordBatchReader(&c_stream);
+  check_arrow(reader.status());
+  return *reader;
+}
+
+// Run a query and wait for its result; consumes the query
+template <typename T>
+std::shared_ptr<arrow::RecordBatchReader> execute(
+    LanceDBFuture* (*execute_async)(T*, LanceDBCompletionCallback, void*), T* query) {
+  // The asynchronous entry point reports why a query failed, the blocking one only NULL
+  LanceDBFuture* future = check_handle(execute_async(query, nullptr, nullptr), "query future");
+  LanceDBQueryResult* result = nullptr;
+  char* error_message = nullptr;
+  check(lancedb_future_get_query_result(future, &result, &error_message), error_message);
+  return import_result(result);
+}
+
+// Hand a record batch reader to the C API; the stream is consumed by the reader
+inline LanceDBRecordBatchReader* export_reader(const std::shared_ptr<arrow::RecordBatchReader>& reader) {
+  struct ArrowArrayStream c_stream;
+  check_arrow(arrow::ExportRecordBatchReader(reader, &c_stream));
+  return check_handle(
+      lancedb_record_batch_reader_from_arrow_stream(reinterpret_cast<FFI_ArrowArrayStream*>(&c_stream)),
+      "record batch reader");
+}
+
+} // namespace detail
+
+/**
+ * Resumes an awaiting coroutine on a new detached thread
+ *
+ * The default executor of execute_async(). Completion callbacks run on a LanceDB runtime
+ * worker thread, where blocking LanceDB calls such as reading a query result must not
+ * run, so the coroutine is moved off it. Pass an executor scheduling onto the
+ * application's own thread pool or event loop to avoid a thread per query.
+ */
+struct NewThreadExecutor {
+  void operator()(std::coroutine_handle<> handle) const {
+    std::thread([handle]() { handle.resume(); }).detach();
+  }
+};
+
+/**
+ * Awaitable execution of a query on the shared LanceDB runtime
+ *
+ * The query starts when the awaitable is awaited and the coroutine is resumed through
+ * the executor once it finished. Awaiting yields the result as a record batch reader.
+ * The awaitable owns the query until then and must be awaited at most once.
+ */
+template <typename QueryHandle, LanceDBFuture* (*Execute)(
+    typename QueryHandle::element_type*, LanceDBCompletionCallback, void*), typename Executor>
+class QueryAwaitable {
+public:
+  QueryAwaitable(QueryHandle query, Executor executor)
+      : query_(std::move(query)), state_(std::make_shared<State>(std::move(executor))) {}
+
+  QueryAwaitable(const QueryAwaitable&) = delete;
+  QueryAwaitable& operator=(const QueryAwaitable&) = delete;
+
+  ~QueryAwaitable() {
+    if (future_) {
+      // The callback still runs once after cancellation and must not resume the coroutine
+      state_->abandoned = true;
+      lancedb_future_free(future_);
+    }
+  }
+
+  bool await_ready() const noexcept { return false; }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    state_->handle = handle;
+    // The callback runs exactly once and owns this reference to the shared state
+    auto* callback_state = new std::shared_ptr<State>(state_);
+    future_ = Execute(query_.release(), &QueryAwaitable::on_complete, callback_state);
+    if (future_ == nullptr) {
+      delete callback_state;
+      return false;
+    }
+    // Whichever of this call and the callback comes second resumes the coroutine
+    return !state_->completed.exchange(true);
+  }
+
+  std::shared_ptr<arrow::RecordBatchReader> await_resume() {
+    if (future_ == nullptr) {
+      throw Error(LANCEDB_INVALID_ARGUMENT, "Failed to start query");
+    }
+    LanceDBQueryResult* result = nullptr;
+    char* error_message = nullptr;
+    LanceDBError code = lancedb_future_get_query_result(std::exchange(future_, nullptr), &result, &error_message);
+    detail::check(code, error_message);
+    return detail::import_result(result);
+  }
+
+private:
+  // Shared with the completion callback, which may outlive the awaitable
+  struct State {
+    explicit State(Executor executor) : executor(std::move(executor)) {}
+
+    Executor executor;
+    std::coroutine_handle<> handle;
+    std::atomic<bool> completed{false};
+    std::atomic<bool> abandoned{false};
+  };
+
+  static void on_complete(void* user_data) {
+    std::unique_ptr<std::shared_ptr<State>> state(static_cast<std::shared_ptr<State>*>(user_data));
+    if (!(*state)->abandoned && (*state)->completed.exchange(true)) {
+      (*state)->executor((*state)->handle);
+    }
+  }
+
+  QueryHandle query_;
+  std::shared_ptr<State> state_;
+  LanceDBFuture* future_ = nullptr;
+};
+
+/**
+ * Scan and filter query of a table
+ */
+class Query {
+public:
+  using HandleType = detail::Handle<LanceDBQuery, lancedb_query_free>;
+
+  explicit Query(LanceDBQuery* query) : handle_(detail::check_handle(query, "query")) {}
+
+  /** Filter rows with a SQL expression */
+  Query& where(const char* filter) {
+    char* error_message = nullptr;
+    detail::check(lancedb_query_where_filter(handle_.get(), filter, &error_message), error_message);
+    return *this;
+  }
+
+  Query& limit(size_t limit) {
+    char* error_message = nullptr;
+    detail::check(lancedb_query_limit(handle_.get(), limit, &error_message), error_message);
+    return *this;
+  }
+
+  Query& offset(size_t offset) {
+    char* error_message = nullptr;
+    detail::check(lancedb_query_offset(handle_.get(), offset, &error_message), error_message);
+    return *this;
+  }
+
+  Query& select(std::span<const char* const> columns) {
+    char* error_message = nullptr;
+    detail::check(lancedb_query_select(handle_.get(), columns.data(), columns.size(), &error_message),
+        error_message);
+    return *this;
+  }
+
+  Query& select(std::initializer_list<const char*> columns) {
+    return select(std::span<const char* const>(columns.begin(), columns.size()));
+  }
+
+  /** Include the "_rowid" column in the results */
+  Query& with_row_id() {
+    char* error_message = nullptr;
+    detail::check(lancedb_query_with_row_id(handle_.get(), &error_message), error_message);
+    return *this;
+  }
+
+  /** Execute the query; consumes it */
+  std::shared_ptr<arrow::RecordBatchReader> execute() {
+    return detail::execute(lancedb_query_execute_async, handle_.release());
+  }
+
+  /** Execute the query asynchronously when awaited; consumes it */
+  template <typename Executor = NewThreadExecutor>
+  auto execute_async(Executor executor = {}) {
+    return QueryAwaitable<HandleType, lancedb_query_execute_async, Executor>(
+        std::move(handle_), std::move(executor));
+  }
+
+  LanceDBQuery* get() const noexcept { return handle_.get(); }
+
+private:
+  HandleType handle_;
+};
+
+/**
+ * Nearest neighbor query of a table
+ */
+class VectorQuery {
+public:
+  using HandleType = detail::Handle<LanceDBVectorQuery, lancedb_vector_query_free>;
+
+  explicit VectorQuery(LanceDBVectorQuery* query) : handle_(detail::check_handle(query, "vector query")) {}
+
+  /** Vector column to search (required if the table has several) */
+  VectorQuery& column(const char* column) {
+    char* error_message = nullptr;
+    detail::check(lancedb_vector_query_column(handle_.get(), column, &error_message), error_message);
+    return *this;
+  }
+
+  VectorQuery& where(const char* filter) {
+    char* error_message = nullptr;
+    detail::check(lancedb_vector_query_where_filter(handle_.get(), filter, &error_message), error_message);
+    return *this;
+  }
+
+  VectorQuery& limit(size_t limit) {
+    char* error_message = nullptr;
+    detail::check(lancedb_vector_query_limit(handle_.get(), limit, &error_message), error_message);
+    return *this;
+  }
+
+  VectorQuery& select(std::span<const char* const> columns) {
+    char* error_message = nullptr;
+    detail::check(lancedb_vector_query_select(handle_.get(), columns.data(), columns.size(), &error_message),
+        error_message);
+    return *this;
+  }
+
+  VectorQuery& select(std::initializer_list<const char*> columns) {
+    return select(std::span<const char* const>(columns.begin(), columns.size()));
+  }
+
+  VectorQuery& distance_type(LanceDBDistanceType distance_type) {
+    char* error_message = nullptr;
+    detail::check(lancedb_vector_query_distance_type(handle_.get(), distance_type, &error_message),
+        error_message);
+    return *this;
+  }
+
+  VectorQuery& nprobes(size_t nprobes) {
+    char* error_message = nullptr;
+    detail::check(lancedb_vector_query_nprobes(handle_.get(), nprobes, &error_message), error_message);
+    return *this;
+  }
+
+  VectorQuery& refine_factor(unsigned int refine_factor) {
+    char* error_message = nullptr;
+    detail::check(lancedb_vector_query_refine_factor(handle_.get(), refine_factor, &error_message),
+        error_message);
+    return *this;
+  }
+
+  VectorQuery& ef(size_t ef) {
+    char* error_message = nullptr;
+    detail::check(lancedb_vector_query_ef(handle_.get(), ef, &error_message), error_message);
+    return *this;
+  }
+
+  /** Search without the vector index */
+  VectorQuery& bypass_vector_index() {
+    char* error_message = nullptr;
+    detail::check(lancedb_vector_query_bypass_vector_index(handle_.get(), &error_message), error_message);
+    return *this;
+  }
+
+  /** Include the "_rowid" column in the results */
+  VectorQuery& with_row_id() {
+    char* error_message = nullptr;
+    detail::check(lancedb_vector_query_with_row_id(handle_.get(), &error_message), error_message);
+    return *this;
+  }
+
+  /** Execute the query; consumes it */
+  std::shared_ptr<arrow::RecordBatchReader> execute() {
+    return detail::execute(lancedb_vector_query_execute_async, handle_.release());
+  }
+
+  /** Execute the query asynchronously when awaited; consumes it */
+  template <typename Executor = NewThreadExecutor>
+  auto execute_async(Executor executor = {}) {
+    return QueryAwaitable<HandleType, lancedb_vector_query_execute_async, Executor>(
+        std::move(handle_), std::move(executor));
+  }
+
+  LanceDBVectorQuery* get() const noexcept { return handle_.get(); }
+
+private:
+  HandleType handle_;
+};
+
+/**
+ * Table of a connection
+ */
+class Table {
+public:
+  explicit Table(LanceDBTable* table) : handle_(detail::check_handle(table, "table")) {}
+
+  unsigned long long count_rows() const { return lancedb_table_count_rows(handle_.get()); }
+
+  unsigned long long version() const { return lancedb_table_version(handle_.get()); }
+
+  /** Read-only handle pinned to a version, sharing the connection's caches */
+  Table checkout(unsigned long long version) const {
+    LanceDBTable* pinned = nullptr;
+    char* error_message = nullptr;
+    detail::check(lancedb_table_checkout(handle_.get(), version, &pinned, &error_message), error_message);
+    return Table(pinned);
+  }
+
+  /** Append all batches of a reader in a single commit */
+  void add(const std::shared_ptr<arrow::RecordBatchReader>& reader) const {
+    char* error_message = nullptr;
+    detail::check(lancedb_table_add(handle_.get(), detail::export_reader(reader), &error_message), error_message);
+  }
+
+  Query query() const { return Query(lancedb_query_new(handle_.get())); }
+
+  /** Nearest neighbor query; the vector is copied by the query */
+  VectorQuery search(std::span<const float> vector) const {
+    return VectorQuery(lancedb_vector_query_new(handle_.get(), vector.data(), vector.size()));
+  }
+
+  LanceDBTable* get() const noexcept { return handle_.get(); }
+
+private:
+  detail::Handle<LanceDBTable, lancedb_table_free> handle_;
+};
+
+/**
+ * Connection to a database
+ */
+class Connection {
+public:
+  explicit Connection(LanceDBConnection* connection) : handle_(detail::check_handle(connection, "connection")) {}
+
+  /** Connect with default options */
+  static Connection connect(const char* uri) {
+    LanceDBConnectBuilder* builder = detail::check_handle(lancedb_connect(uri), "connect builder");
+    LanceDBConnection* connection = nullptr;
+    char* error_message = nullptr;
+    detail::check(lancedb_connect_builder_try_execute(builder, &connection, &error_message), error_message);
+    return Connection(connection);
+  }
+
+  Table open_table(const char* name) const {
+    LanceDBTable* table = lancedb_connection_open_table(handle_.get(), name);
+    if (table == nullptr) {
+      throw Error(LANCEDB_TABLE_NOT_FOUND, std::string("Failed to open table ") + name);
+    }
+    return Table(table);
+  }
+
+  /** Create a table, optionally with initial data */
+  Table create_table(const char* name, const arrow::Schema& schema,
+                     const std::shared_ptr<arrow::RecordBatchReader>& reader = nullptr) const {
+    struct ArrowSchema c_schema;
+    detail::check_arrow(arrow::ExportSchema(schema, &c_schema));
+    LanceDBRecordBatchReader* data = nullptr;
+    LanceDBTable* table = nullptr;
+    char* error_message = nullptr;
+    LanceDBError code = LANCEDB_SUCCESS;
+    try {
+      data = reader ? detail::export_reader(reader) : nullptr;
+      code = lancedb_table_create(handle_.get(), name, reinterpret_cast<FFI_ArrowSchema*>(&c_schema), data,
+          &table, &error_message);
+    } catch (...) {
+      c_schema.release(&c_schema);
+      throw;
+    }
+    // The schema is only read by the call
+    c_schema.release(&c_schema);
+    detail::check(code, error_message);
+    return Table(table);
+  }
+
+  std::vector<std::string> table_names() const {
+    char** names = nullptr;
+    size_t count = 0;
+    char* error_message = nullptr;
+    detail::check(lancedb_connection_table_names(handle_.get(), &names, &count, &error_message), error_message);
+    std::vector<std::string> result(names, names + count);
+    lancedb_free_table_names(names, count);
+    return result;
+  }
+
+  void drop_table(const char* name) const {
+    char* error_message = nullptr;
+    detail::check(lancedb_connection_drop_table(handle_.get(), name, nullptr, &error_message), error_message);
+  }
+
+  LanceDBConnection* get() const noexcept { return handle_.get(); }
+
+private:
+  detail::Handle<LanceDBConnection, lancedb_connection_free> handle_;
+};
+
+} // namespace lancedb
+
+#endif // LANCEDB_HPP
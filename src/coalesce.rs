@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The LanceDB Authors
+
+//! Coalescing of concurrent vector queries for LanceDB C bindings
+//!
+//! With coalescing enabled on a connection, a vector query waits up to the configured
+//! window for concurrent queries against the same table version with the same parameters.
+//! The collected queries run as a single multi-vector query, so the table is opened, the
+//! index is probed and the results are read once per batch instead of once per query.
+//! Identical query vectors are searched once and their results are shared by all callers.
+
+use std::collections::HashMap;
+use std::sync::{Arc, Mutex};
+use std::time::Duration;
+
+use arrow::compute::{cast, take_record_batch};
+use arrow_array::cast::AsArray;
+use arrow_array::types::UInt64Type;
+use arrow_array::{ArrayRef, RecordBatch, UInt32Array};
+use arrow_schema::{DataType, Schema, SchemaRef};
+use futures::TryStreamExt;
+use lancedb::arrow::{SendableRecordBatchStream, SimpleRecordBatchStream};
+use tokio::sync::{oneshot, Notify};
+
+use crate::connection::get_runtime;
+use crate::metrics::Span;
+use crate::query::{build_vector_query, LanceDBVectorQuery};
+
+/// Batches of up to this many queries when no batch size is configured
+const DEFAULT_MAX_BATCH_SIZE: usize = 64;
+
+type SharedResult = Result<(SchemaRef, Vec<RecordBatch>), Arc<lancedb::error::Error>>;
+
+/// Distinct query vector of a batch and the callers waiting for its results
+struct Member {
+    vector: ArrayRef,
+    waiters: Vec<oneshot::Sender<SharedResult>>,
+}
+
+/// Queries collected for one execution
+struct PendingBatch {
+    members: Mutex<Vec<Member>>,
+    full: Notify,
+}
+
+/// Coalesces the vector queries of a connection
+pub(crate) struct QueryCoalescer {
+    window: Duration,
+    max_batch_size: usize,
+    pending: Mutex<HashMap<String, Arc<PendingBatch>>>,
+}
+
+impl QueryCoalescer {
+    pub(crate) fn new(window: Duration, max_batch_size: usize) -> Self {
+        Self {
+            window,
+            max_batch_size: if max_batch_size > 0 {
+                max_batch_size
+            } else {
+                DEFAULT_MAX_BATCH_SIZE
+            },
+            pending: Mutex::new(HashMap::new()),
+        }
+    }
+
+    /// Execute a query as part of the batch of queries sharing `key`
+    pub(crate) async fn execute(
+        self: Arc<Self>,
+        key: String,
+        query: LanceDBVectorQuery,
+    ) -> lancedb::error::Result<SendableRecordBatchStream> {
+        let (sender, receiver) = oneshot::channel();
+        let vector = query.first_query_vector();
+
+        let new_batch = {
+            let mut pending = self.pending.lock().unwrap();
+            if let Some(batch) = pending.get(&key) {
+                let mut members = batch.members.lock().unwrap();
+                let vector_data = vector.to_data();
+                match members
+                    .iter_mut()
+                    .find(|member| member.vector.to_data() == vector_data)
+                {
+                    Some(member) => member.waiters.push(sender),
+                    None => members.push(Member {
+                        vector,
+                        waiters: vec![sender],
+                    }),
+                }
+                // A full batch starts right away; later queries open a new one
+                if members.len() >= self.max_batch_size {
+                    drop(members);
+                    if let Some(batch) = pending.remove(&key) {
+                        batch.full.notify_one();
+                    }
+                }
+                None
+            } else {
+                let batch = Arc::new(PendingBatch {
+                    members: Mutex::new(vec![Member {
+                        vector,
+                        waiters: vec![sender],
+                    }]),
+                    full: Notify::new(),
+                });
+                pending.insert(key.clone(), batch.clone());
+                Some(batch)
+            }
+        };
+
+        // The first query of a batch schedules it. The batch runs as a separate task, so
+        // cancelling that query does not fail the others.
+        if let Some(batch) = new_batch {
+            let coalescer = self.clone();
+            get_runtime().spawn(async move {
+                let _ = tokio::time::timeout(coalescer.window, batch.full.notified()).await;
+                {
+                    let mut pending = coalescer.pending.lock().unwrap();
+                    if pending
+                        .get(&key)
+                        .is_some_and(|current| Arc::ptr_eq(current, &batch))
+                    {
+                        pending.remove(&key);
+                    }
+                }
+                let members = std::mem::take(&mut *batch.members.lock().unwrap());
+                run_batch(query, members).await;
+            });
+        }
+
+        match receiver.await {
+            Ok(Ok((schema, batches))) => Ok(Box::pin(SimpleRecordBatchStream::new(
+                futures::stream::iter(batches.into_iter().map(Ok)),
+                schema,
+            ))),
+            Ok(Err(e)) => Err(clone_error(&e)),
+            Err(_) => Err(lancedb::error::Error::Runtime {
+                message: "coalesced vector query was cancelled".to_string(),
+            }),
+        }
+    }
+}
+
+/// Run the queries of a batch as one multi-vector query and hand out the results
+async fn run_batch(template: LanceDBVectorQuery, members: Vec<Member>) {
+    let span = Span::start(c"vector_query_coalesced");
+    let query = template.with_query_vectors(members.iter().map(|m| m.vector.clone()).collect());
+    let result = async {
+        let stream = build_vector_query(query)?.execute().await?;
+        let schema = stream.schema();
+        let batches: Vec<RecordBatch> = stream.try_collect().await?;
+        if members.len() == 1 {
+            Ok((schema, vec![batches]))
+        } else {
+            split_by_query_index(&schema, &batches, members.len())
+        }
+    }
+    .await;
+    span.finish(result.is_err());
+
+    match result {
+        Ok((schema, per_query)) => {
+            for (member, batches) in members.into_iter().zip(per_query) {
+                for waiter in member.waiters {
+                    let _ = waiter.send(Ok((schema.clone(), batches.clone())));
+                }
+            }
+        }
+        Err(e) => {
+            let e = Arc::new(e);
+            for waiter in members.into_iter().flat_map(|member| member.waiters) {
+                let _ = waiter.send(Err(e.clone()));
+            }
+        }
+    }
+}
+
+/// Split the results of a multi-vector query by their `query_index` column
+fn split_by_query_index(
+    schema: &SchemaRef,
+    batches: &[RecordBatch],
+    num_queries: usize,
+) -> lancedb::error::Result<(SchemaRef, Vec<Vec<RecordBatch>>)> {
+    let index_column = schema.index_of("query_index")?;
+    let mut fields = schema.fields().to_vec();
+    fields.remove(index_column);
+    let result_schema = Arc::new(Schema::new_with_metadata(fields, schema.metadata().clone()));
+
+    let mut per_query = vec![Vec::new(); num_queries];
+    for batch in batches {
+        let query_index = cast(batch.column(index_column), &DataType::UInt64)?;
+        let mut rows = vec![Vec::new(); num_queries];
+        for (row, query) in query_index.as_primitive::<UInt64Type>().iter().enumerate() {
+            if let Some(query) = query.filter(|query| (*query as usize) < num_queries) {
+                rows[query as usize].push(row as u32);
+            }
+        }
+
+        let mut results = batch.clone();
+        results.remove_column(index_column);
+        for (query, rows) in rows.into_iter().enumerate() {
+            if !rows.is_empty() {
+                per_query[query].push(take_record_batch(&results, &UInt32Array::from(rows))?);
+            }
+        }
+    }
+
+    Ok((result_schema, per_query))
+}
+
+/// Copy of an error shared by the queries of a batch
+fn clone_error(error: &lancedb::error::Error) -> lancedb::error::Error {
+    match error {
+        lancedb::error::Error::InvalidInput { message } => lancedb::error::Error::InvalidInput {
+            message: message.clone(),
+        },
+        lancedb::error::Error::NotSupported { message } => lancedb::error::Error::NotSupported {
+            message: message.clone(),
+        },
+        lancedb::error::Error::Schema { message } => lancedb::error::Error::Schema {
+            message: message.clone(),
+        },
+        other => lancedb::error::Error::Runtime {
+            message: other.to_string(),
+        },
+    }
+}
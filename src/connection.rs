@@ -3,27 +3,73 @@
 
 //! Connection-related FFI functions for LanceDB C bindings
 
+use std::collections::{HashMap, VecDeque};
 use std::ffi::{CStr, CString};
-use std::os::raw::c_char;
+use std::future::Future;
+use std::os::raw::{c_char, c_int, c_void};
 use std::ptr;
+use std::sync::atomic::{AtomicUsize, Ordering};
 use std::sync::Arc;
-use std::sync::OnceLock;
+use std::sync::{Mutex, OnceLock};
+use std::time::{Duration, Instant};
 
 use arrow_array::{RecordBatch, RecordBatchIterator, RecordBatchReader};
-use arrow_schema::Schema;
+use arrow_schema::{DataType, Schema, SchemaRef};
+use lance::dataset::{DEFAULT_INDEX_CACHE_SIZE, DEFAULT_METADATA_CACHE_SIZE};
+use lance::session::Session;
 use lancedb::connection::{connect, ConnectBuilder, Connection, TableNamesBuilder};
 use lancedb::database::{CreateNamespaceRequest, DropNamespaceRequest, ListNamespacesRequest};
 use lancedb::Table;
 
+use crate::coalesce::QueryCoalescer;
 use crate::error::{
     handle_error, set_invalid_argument_message, set_unknown_error_message, LanceDBError,
 };
+use crate::fragment::DatasetOptions;
+use crate::memory::{LanceDBMemoryStats, MemoryPool};
+use crate::metrics::{Outcome, Span};
+use crate::store::{LanceDBObjectStoreConfig, ObjectStoreConfig};
 use crate::types::LanceDBRecordBatchReader;
 
 /// Opaque handle to a ConnectBuilder
 #[repr(C)]
 pub struct LanceDBConnectBuilder {
     inner: Box<ConnectBuilder>,
+    options: ConnectOptions,
+}
+
+/// Builder options applied by the bindings when the connection is created
+#[derive(Debug, Default, Clone)]
+struct ConnectOptions {
+    index_cache_bytes: Option<usize>,            // None = Lance default
+    metadata_cache_bytes: Option<usize>,         // None = Lance default
+    table_cache_size: usize,                     // 0 = no table handle cache
+    read_consistency_interval: Option<Duration>, // None = never check for other writers
+    storage_options: HashMap<String, String>,    // Also used for datasets opened by the bindings
+    coalesce_window: Option<Duration>,           // None = queries are not coalesced
+    coalesce_max_batch_size: usize,              // 0 = default batch size
+    object_store: Option<ObjectStoreConfig>,     // None = Lance object store defaults
+    memory_limit: usize,                         // 0 = unlimited
+}
+
+impl ConnectOptions {
+    /// Session with the configured cache sizes and object store settings
+    ///
+    /// Created even if all of them are defaults, so datasets opened by the bindings and
+    /// checked out table versions share the caches of the connection.
+    /// Fails if the disk cache directory cannot be created.
+    fn session(&self) -> std::io::Result<Arc<Session>> {
+        let store_registry = match &self.object_store {
+            Some(config) => config.registry()?,
+            None => Arc::default(),
+        };
+        Ok(Arc::new(Session::new(
+            self.index_cache_bytes.unwrap_or(DEFAULT_INDEX_CACHE_SIZE),
+            self.metadata_cache_bytes
+                .unwrap_or(DEFAULT_METADATA_CACHE_SIZE),
+            store_registry,
+        )))
+    }
 }
 
 /// Opaque handle to a Connection
@@ -32,12 +78,251 @@ pub struct LanceDBConnection {
     pub(crate) inner: Connection,
     // Cache the URI as a C-compatible string for safe return from lancedb_connection_uri
     uri_cache: OnceLock<CString>,
+    table_cache: Mutex<TableCache>,
+    read_consistency_interval: Option<Duration>,
+    dataset_options: Arc<DatasetOptions>,
+    coalescer: Option<Arc<QueryCoalescer>>,
+    memory: Arc<MemoryPool>,
+}
+
+impl LanceDBConnection {
+    fn new_table(&self, table: Table) -> LanceDBTable {
+        LanceDBTable {
+            inner: table,
+            snapshot: Arc::new(SnapshotCache {
+                max_age: self.read_consistency_interval,
+                state: Mutex::new(SnapshotState::default()),
+            }),
+            dataset_options: self.dataset_options.clone(),
+            coalescer: self.coalescer.clone(),
+            memory: self.memory.clone(),
+            connection: self.inner.clone(),
+            pinned: false,
+        }
+    }
+}
+
+/// LRU cache of open table handles, least recently used first
+struct TableCache {
+    capacity: usize,
+    entries: VecDeque<(String, LanceDBTable)>,
+}
+
+impl TableCache {
+    fn get(&mut self, name: &str) -> Option<LanceDBTable> {
+        let position = self.entries.iter().position(|(n, _)| n == name)?;
+        let entry = self.entries.remove(position)?;
+        let table = entry.1.clone();
+        self.entries.push_back(entry);
+        Some(table)
+    }
+
+    fn insert(&mut self, name: &str, table: &LanceDBTable) {
+        if self.capacity == 0 {
+            return;
+        }
+        self.remove(name);
+        if self.entries.len() >= self.capacity {
+            self.entries.pop_front();
+        }
+        self.entries.push_back((name.to_string(), table.clone()));
+    }
+
+    fn remove(&mut self, name: &str) {
+        self.entries.retain(|(n, _)| n != name);
+    }
+
+    fn clear(&mut self) {
+        self.entries.clear();
+    }
 }
 
 /// Opaque handle to a Table
 #[repr(C)]
+#[derive(Clone)]
 pub struct LanceDBTable {
     pub(crate) inner: Table,
+    // Shared by all handles of the table served from the connection's table cache
+    pub(crate) snapshot: Arc<SnapshotCache>,
+    // Storage options and session of the connection, for datasets opened directly through Lance
+    pub(crate) dataset_options: Arc<DatasetOptions>,
+    // Vector query coalescing of the connection, if enabled
+    pub(crate) coalescer: Option<Arc<QueryCoalescer>>,
+    // Memory pool of the connection, charged with query results and ingested batches
+    pub(crate) memory: Arc<MemoryPool>,
+    // Connection the table was opened through, for opening further handles of it
+    pub(crate) connection: Connection,
+    // Whether the handle is pinned to a version by `lancedb_table_checkout`
+    pub(crate) pinned: bool,
+}
+
+impl LanceDBTable {
+    /// Read-only handle of the table pinned to `version`
+    ///
+    /// The handle is opened through the same connection, so it shares the Lance session
+    /// and its index and metadata caches with this one. A pinned version never changes, so
+    /// its snapshot stays valid regardless of the read consistency interval.
+    pub(crate) async fn checkout(&self, version: u64) -> lancedb::error::Result<Self> {
+        let table = self
+            .connection
+            .open_table(self.inner.name())
+            .execute()
+            .await?;
+        table.checkout(version).await?;
+        Ok(Self {
+            inner: table,
+            snapshot: Arc::new(SnapshotCache {
+                max_age: None,
+                state: Mutex::new(SnapshotState::default()),
+            }),
+            dataset_options: self.dataset_options.clone(),
+            coalescer: self.coalescer.clone(),
+            memory: self.memory.clone(),
+            connection: self.connection.clone(),
+            pinned: true,
+        })
+    }
+}
+
+/// Schema and version of a table at a point in time
+#[derive(Clone)]
+pub(crate) struct TableSnapshot {
+    pub(crate) version: u64,
+    pub(crate) schema: SchemaRef,
+    pub(crate) taken_at: Instant,
+    // Only vector column of the schema if it holds single vectors, the column vector
+    // queries without an explicit column can be coalesced on
+    pub(crate) default_vector_column: Option<String>,
+}
+
+impl TableSnapshot {
+    pub(crate) fn new(version: u64, schema: SchemaRef, taken_at: Instant) -> Self {
+        let mut vector_columns = schema
+            .fields()
+            .iter()
+            .filter(|field| match field.data_type() {
+                DataType::FixedSizeList(..) => true,
+                DataType::List(inner) => matches!(inner.data_type(), DataType::FixedSizeList(..)),
+                _ => false,
+            });
+        let default_vector_column = match (vector_columns.next(), vector_columns.next()) {
+            (Some(field), None) if matches!(field.data_type(), DataType::FixedSizeList(..)) => {
+                Some(field.name().clone())
+            }
+            _ => None,
+        };
+        Self {
+            version,
+            schema,
+            taken_at,
+            default_vector_column,
+        }
+    }
+}
+
+/// Cached snapshot of a table, dropped on every write through the bindings
+pub(crate) struct SnapshotCache {
+    pub(crate) max_age: Option<Duration>, // Read consistency interval of the connection
+    state: Mutex<SnapshotState>,
+}
+
+/// Maximum number of cached row counts per table
+const MAX_CACHED_COUNTS: usize = 1024;
+
+#[derive(Default)]
+struct SnapshotState {
+    // Bumped by every write, so a refresh racing with a write is not stored
+    generation: u64,
+    current: Option<TableSnapshot>,
+    // Row counts by filter (None = all rows), with the time they were counted
+    counts: HashMap<Option<String>, (u64, Instant)>,
+}
+
+impl SnapshotCache {
+    /// Maximum age of cached values accepted by a call (-1 = read consistency interval)
+    pub(crate) fn max_age(&self, max_staleness_ms: i64) -> Option<Duration> {
+        if max_staleness_ms < 0 {
+            self.max_age
+        } else {
+            Some(Duration::from_millis(max_staleness_ms as u64))
+        }
+    }
+
+    /// Snapshot taken at most `max_age` ago (None = any age), and the current generation
+    pub(crate) fn get(&self, max_age: Option<Duration>) -> (Option<TableSnapshot>, u64) {
+        let state = self.state.lock().unwrap();
+        let current = state
+            .current
+            .as_ref()
+            .filter(|snapshot| max_age.map_or(true, |age| snapshot.taken_at.elapsed() <= age));
+        (current.cloned(), state.generation)
+    }
+
+    /// Snapshot taken at most `max_age` ago, fetched from the table if there is none
+    pub(crate) async fn current(
+        &self,
+        tbl: &Table,
+        max_age: Option<Duration>,
+    ) -> lancedb::error::Result<TableSnapshot> {
+        let (cached, generation) = self.get(max_age);
+        if let Some(snapshot) = cached {
+            return Ok(snapshot);
+        }
+
+        let taken_at = Instant::now();
+        let version = tbl.version().await?;
+        let schema = tbl.schema().await?;
+        let snapshot = TableSnapshot::new(version, schema, taken_at);
+        self.store(generation, snapshot.clone());
+        Ok(snapshot)
+    }
+
+    /// Store a snapshot taken in `generation`, unless a write happened since
+    pub(crate) fn store(&self, generation: u64, snapshot: TableSnapshot) {
+        let mut state = self.state.lock().unwrap();
+        if state.generation == generation {
+            state.current = Some(snapshot);
+        }
+    }
+
+    /// Row count counted at most `max_age` ago (None = any age), and the current generation
+    pub(crate) fn get_count(
+        &self,
+        filter: &Option<String>,
+        max_age: Option<Duration>,
+    ) -> (Option<u64>, u64) {
+        let state = self.state.lock().unwrap();
+        let count = state
+            .counts
+            .get(filter)
+            .filter(|(_, counted_at)| max_age.map_or(true, |age| counted_at.elapsed() <= age))
+            .map(|(count, _)| *count);
+        (count, state.generation)
+    }
+
+    /// Store a row count counted in `generation`, unless a write happened since
+    pub(crate) fn store_count(
+        &self,
+        generation: u64,
+        filter: Option<String>,
+        count: u64,
+        counted_at: Instant,
+    ) {
+        let mut state = self.state.lock().unwrap();
+        if state.generation == generation {
+            if state.counts.len() >= MAX_CACHED_COUNTS && !state.counts.contains_key(&filter) {
+                state.counts.clear();
+            }
+            state.counts.insert(filter, (count, counted_at));
+        }
+    }
+
+    pub(crate) fn invalidate(&self) {
+        let mut state = self.state.lock().unwrap();
+        state.generation += 1;
+        state.current = None;
+        state.counts.clear();
+    }
 }
 
 /// Opaque handle to a TableNamesBuilder
@@ -46,6 +331,33 @@ pub struct LanceDBTableNamesBuilder {
     inner: Box<TableNamesBuilder>,
 }
 
+/// Callback invoked on every runtime thread right after it starts
+pub type LanceDBThreadStartCallback =
+    Option<unsafe extern "C" fn(thread_index: usize, user_data: *mut c_void)>;
+
+/// Runtime configuration
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct LanceDBRuntimeConfig {
+    pub worker_threads: c_int, // Number of worker threads (-1 = one per core)
+    pub max_blocking_threads: c_int, // Maximum threads of the blocking pool (-1 = default)
+    pub thread_name_prefix: *const c_char, // Prefix of runtime thread names (NULL = default)
+    pub current_thread: c_int, // Use a runtime driven by the calling threads (1 = true, 0 = false)
+    pub on_thread_start: LanceDBThreadStartCallback, // Called on each new runtime thread (NULL = none)
+    pub user_data: *mut c_void,                      // Opaque pointer passed to on_thread_start
+}
+
+/// User data pointer moved into the runtime thread start hook
+struct ThreadStartHook {
+    callback: unsafe extern "C" fn(thread_index: usize, user_data: *mut c_void),
+    user_data: *mut c_void,
+    next_index: AtomicUsize,
+}
+
+// The user data pointer is only handed back to the caller's callback
+unsafe impl Send for ThreadStartHook {}
+unsafe impl Sync for ThreadStartHook {}
+
 /// Runtime to handle async operations
 static RUNTIME: OnceLock<tokio::runtime::Runtime> = OnceLock::new();
 
@@ -53,6 +365,103 @@ pub(crate) fn get_runtime() -> &'static tokio::runtime::Runtime {
     RUNTIME.get_or_init(|| tokio::runtime::Runtime::new().expect("Failed to create tokio runtime"))
 }
 
+/// Run a future to completion on the runtime, recording it as `operation`
+pub(crate) fn block_on<F>(operation: &'static CStr, future: F) -> F::Output
+where
+    F: Future,
+    F::Output: Outcome,
+{
+    let span = Span::start(operation);
+    let output = get_runtime().block_on(future);
+    span.finish(output.is_error());
+    output
+}
+
+/// Build a tokio runtime from the C configuration
+unsafe fn build_runtime(
+    config: &LanceDBRuntimeConfig,
+) -> lancedb::error::Result<tokio::runtime::Runtime> {
+    let mut builder = if config.current_thread != 0 {
+        tokio::runtime::Builder::new_current_thread()
+    } else {
+        tokio::runtime::Builder::new_multi_thread()
+    };
+    builder.enable_all();
+
+    if config.worker_threads > 0 {
+        builder.worker_threads(config.worker_threads as usize);
+    }
+    if config.max_blocking_threads > 0 {
+        builder.max_blocking_threads(config.max_blocking_threads as usize);
+    }
+    if !config.thread_name_prefix.is_null() {
+        let Ok(prefix) = CStr::from_ptr(config.thread_name_prefix).to_str() else {
+            return Err(lancedb::error::Error::InvalidInput {
+                message: "Runtime thread name prefix is not valid UTF-8".to_string(),
+            });
+        };
+        let prefix = prefix.to_string();
+        let next_id = AtomicUsize::new(0);
+        builder.thread_name_fn(move || {
+            format!("{}-{}", prefix, next_id.fetch_add(1, Ordering::Relaxed))
+        });
+    }
+    if let Some(callback) = config.on_thread_start {
+        let hook = ThreadStartHook {
+            callback,
+            user_data: config.user_data,
+            next_index: AtomicUsize::new(0),
+        };
+        builder.on_thread_start(move || {
+            let index = hook.next_index.fetch_add(1, Ordering::Relaxed);
+            unsafe { (hook.callback)(index, hook.user_data) };
+        });
+    }
+
+    builder.build().map_err(|e| lancedb::error::Error::Runtime {
+        message: format!("Failed to create tokio runtime: {e}"),
+    })
+}
+
+/// Initialize the runtime used for all LanceDB operations
+///
+/// # Safety
+/// - `config` must be a valid pointer to LanceDBRuntimeConfig
+/// - `config.thread_name_prefix` must be NULL or a valid null-terminated C string
+/// - `config.on_thread_start` must be safe to call from any thread with `config.user_data`
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - Fails with `Runtime` if the runtime was already initialized (explicitly or by any other call)
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_runtime_init(
+    config: *const LanceDBRuntimeConfig,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if config.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let already_initialized = lancedb::error::Error::Runtime {
+        message: "LanceDB runtime is already initialized".to_string(),
+    };
+    if RUNTIME.get().is_some() {
+        return handle_error(&already_initialized, error_message);
+    }
+
+    let runtime = match build_runtime(&*config) {
+        Ok(runtime) => runtime,
+        Err(e) => return handle_error(&e, error_message),
+    };
+
+    match RUNTIME.set(runtime) {
+        Ok(_) => LanceDBError::Success,
+        Err(_) => handle_error(&already_initialized, error_message),
+    }
+}
+
 /// Create a ConnectBuilder for the given URI
 ///
 /// # Safety
@@ -75,6 +484,7 @@ pub unsafe extern "C" fn lancedb_connect(uri: *const c_char) -> *mut LanceDBConn
     let builder = connect(str_uri);
     let boxed_builder = Box::new(LanceDBConnectBuilder {
         inner: Box::new(builder),
+        options: ConnectOptions::default(),
     });
 
     Box::into_raw(boxed_builder)
@@ -88,28 +498,75 @@ pub unsafe extern "C" fn lancedb_connect(uri: *const c_char) -> *mut LanceDBConn
 ///
 /// # Returns
 /// - Non-null pointer to LanceDBConnection on success
-/// - Null pointer on failure
+/// - Null pointer on failure; use `lancedb_connect_builder_try_execute` for the reason
 #[no_mangle]
 pub unsafe extern "C" fn lancedb_connect_builder_execute(
     builder: *mut LanceDBConnectBuilder,
 ) -> *mut LanceDBConnection {
-    if builder.is_null() {
-        return ptr::null_mut();
+    let mut connection = ptr::null_mut();
+    lancedb_connect_builder_try_execute(builder, &mut connection, ptr::null_mut());
+    connection
+}
+
+/// Execute the connection and report why it failed
+///
+/// # Safety
+/// - `builder` must be a valid pointer returned from `lancedb_connect`
+/// - `builder` will be consumed and must not be used after calling this function
+/// - `connection_out` must be a valid pointer to receive the connection
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_connect_builder_try_execute(
+    builder: *mut LanceDBConnectBuilder,
+    connection_out: *mut *mut LanceDBConnection,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if builder.is_null() || connection_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
     }
 
+    *connection_out = ptr::null_mut();
     let builder_box = Box::from_raw(builder);
-    let connect_builder = *builder_box.inner;
+    let options = builder_box.options;
+    let mut connect_builder = *builder_box.inner;
+    let session = match options.session() {
+        Ok(session) => session,
+        Err(e) => {
+            let error = lancedb::error::Error::Runtime {
+                message: format!("failed to set up the object store session: {e}"),
+            };
+            return handle_error(&error, error_message);
+        }
+    };
+    connect_builder = connect_builder.session(session.clone());
 
-    let runtime = get_runtime();
-    match runtime.block_on(connect_builder.execute()) {
+    match block_on(c"connect_builder_execute", connect_builder.execute()) {
         Ok(connection) => {
             let boxed_connection = Box::new(LanceDBConnection {
                 inner: connection,
                 uri_cache: OnceLock::new(),
+                table_cache: Mutex::new(TableCache {
+                    capacity: options.table_cache_size,
+                    entries: VecDeque::new(),
+                }),
+                read_consistency_interval: options.read_consistency_interval,
+                dataset_options: Arc::new(DatasetOptions {
+                    storage_options: options.storage_options,
+                    session: Some(session),
+                }),
+                coalescer: options.coalesce_window.map(|window| {
+                    Arc::new(QueryCoalescer::new(window, options.coalesce_max_batch_size))
+                }),
+                memory: Arc::new(MemoryPool::new(options.memory_limit)),
             });
-            Box::into_raw(boxed_connection)
+            *connection_out = Box::into_raw(boxed_connection);
+            LanceDBError::Success
         }
-        Err(_) => ptr::null_mut(),
+        Err(e) => handle_error(&e, error_message),
     }
 }
 
@@ -135,6 +592,7 @@ pub unsafe extern "C" fn lancedb_connect_builder_storage_option(
     }
 
     let builder_box = Box::from_raw(builder);
+    let mut options = builder_box.options;
 
     if key.is_null() || value.is_null() {
         return ptr::null_mut();
@@ -150,13 +608,221 @@ pub unsafe extern "C" fn lancedb_connect_builder_storage_option(
 
     let connect_builder = *builder_box.inner;
     let updated_builder = connect_builder.storage_option(key_str, value_str);
+    options
+        .storage_options
+        .insert(key_str.to_string(), value_str.to_string());
     let boxed_builder = Box::new(LanceDBConnectBuilder {
         inner: Box::new(updated_builder),
+        options,
     });
 
     Box::into_raw(boxed_builder)
 }
 
+/// Set the size of the index cache
+///
+/// # Safety
+/// - `builder` must be a valid pointer returned from `lancedb_connect`
+/// - `builder` will be consumed and must not be used after calling this function
+///
+/// # Returns
+/// - A new pointer to LanceDBConnectBuilder on success
+/// - Null pointer on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_connect_builder_index_cache_size(
+    builder: *mut LanceDBConnectBuilder,
+    size_bytes: usize,
+) -> *mut LanceDBConnectBuilder {
+    if builder.is_null() {
+        return ptr::null_mut();
+    }
+
+    let mut builder_box = Box::from_raw(builder);
+    builder_box.options.index_cache_bytes = Some(size_bytes);
+    Box::into_raw(builder_box)
+}
+
+/// Set the size of the metadata cache
+///
+/// # Safety
+/// - `builder` must be a valid pointer returned from `lancedb_connect`
+/// - `builder` will be consumed and must not be used after calling this function
+///
+/// # Returns
+/// - A new pointer to LanceDBConnectBuilder on success
+/// - Null pointer on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_connect_builder_metadata_cache_size(
+    builder: *mut LanceDBConnectBuilder,
+    size_bytes: usize,
+) -> *mut LanceDBConnectBuilder {
+    if builder.is_null() {
+        return ptr::null_mut();
+    }
+
+    let mut builder_box = Box::from_raw(builder);
+    builder_box.options.metadata_cache_bytes = Some(size_bytes);
+    Box::into_raw(builder_box)
+}
+
+/// Set how often tables of the connection check for updates by other writers
+///
+/// # Safety
+/// - `builder` must be a valid pointer returned from `lancedb_connect`
+/// - `builder` will be consumed and must not be used after calling this function
+///
+/// # Returns
+/// - A new pointer to LanceDBConnectBuilder on success
+/// - Null pointer on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_connect_builder_read_consistency_interval(
+    builder: *mut LanceDBConnectBuilder,
+    interval_ms: u64,
+) -> *mut LanceDBConnectBuilder {
+    if builder.is_null() {
+        return ptr::null_mut();
+    }
+
+    let builder_box = Box::from_raw(builder);
+    let interval = Duration::from_millis(interval_ms);
+    let mut options = builder_box.options;
+    options.read_consistency_interval = Some(interval);
+    let connect_builder = *builder_box.inner;
+    let updated_builder = connect_builder.read_consistency_interval(interval);
+    let boxed_builder = Box::new(LanceDBConnectBuilder {
+        inner: Box::new(updated_builder),
+        options,
+    });
+
+    Box::into_raw(boxed_builder)
+}
+
+/// Set the number of open table handles kept by the connection
+///
+/// # Safety
+/// - `builder` must be a valid pointer returned from `lancedb_connect`
+/// - `builder` will be consumed and must not be used after calling this function
+///
+/// # Returns
+/// - A new pointer to LanceDBConnectBuilder on success
+/// - Null pointer on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_connect_builder_table_cache_size(
+    builder: *mut LanceDBConnectBuilder,
+    capacity: usize,
+) -> *mut LanceDBConnectBuilder {
+    if builder.is_null() {
+        return ptr::null_mut();
+    }
+
+    let mut builder_box = Box::from_raw(builder);
+    builder_box.options.table_cache_size = capacity;
+    Box::into_raw(builder_box)
+}
+
+/// Enable coalescing of concurrent vector queries
+///
+/// Vector queries wait up to `window_us` microseconds for concurrent queries against the
+/// same table version with the same parameters, then run together as one multi-vector
+/// query of at most `max_batch_size` distinct query vectors (0 = default of 64). Identical
+/// query vectors are searched once. Hybrid, reranked and multivector queries are not
+/// coalesced. A `window_us` of 0 disables coalescing.
+///
+/// # Safety
+/// - `builder` must be a valid pointer returned from `lancedb_connect`
+/// - `builder` will be consumed and must not be used after calling this function
+///
+/// # Returns
+/// - A new pointer to LanceDBConnectBuilder on success
+/// - Null pointer on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_connect_builder_query_coalescing(
+    builder: *mut LanceDBConnectBuilder,
+    window_us: u64,
+    max_batch_size: usize,
+) -> *mut LanceDBConnectBuilder {
+    if builder.is_null() {
+        return ptr::null_mut();
+    }
+
+    let mut builder_box = Box::from_raw(builder);
+    builder_box.options.coalesce_window = (window_us > 0).then(|| Duration::from_micros(window_us));
+    builder_box.options.coalesce_max_batch_size = max_batch_size;
+    Box::into_raw(builder_box)
+}
+
+/// Tune the object stores of the connection and enable a local disk cache
+///
+/// Settings left at 0 keep the Lance defaults. The timeouts and retry limits become storage
+/// options of the connection, so storage options set later override them. Concurrency, block
+/// size, request size and the disk cache apply to remote stores (S3, GCS, Azure, OSS) only.
+///
+/// # Safety
+/// - `builder` must be a valid pointer returned from `lancedb_connect`
+/// - `builder` will be consumed and must not be used after calling this function
+/// - `config` must be a valid pointer to LanceDBObjectStoreConfig or null for defaults
+///
+/// # Returns
+/// - A new pointer to LanceDBConnectBuilder on success
+/// - Null pointer on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_connect_builder_object_store_config(
+    builder: *mut LanceDBConnectBuilder,
+    config: *const LanceDBObjectStoreConfig,
+) -> *mut LanceDBConnectBuilder {
+    if builder.is_null() {
+        return ptr::null_mut();
+    }
+
+    let builder_box = Box::from_raw(builder);
+    let mut options = builder_box.options;
+
+    let Some(config) = LanceDBObjectStoreConfig::from_c(config) else {
+        return ptr::null_mut();
+    };
+    let Ok((store_config, storage_options)) = ObjectStoreConfig::from_c(&config) else {
+        return ptr::null_mut();
+    };
+
+    let mut connect_builder = *builder_box.inner;
+    for (key, value) in storage_options {
+        connect_builder = connect_builder.storage_option(key, &value);
+        options.storage_options.insert(key.to_string(), value);
+    }
+    options.object_store = Some(store_config);
+    Box::into_raw(Box::new(LanceDBConnectBuilder {
+        inner: Box::new(connect_builder),
+        options,
+    }))
+}
+
+/// Limit the memory held by query results and ingested batches of the connection
+///
+/// A result batch or ingested batch that would take the connection's tracked memory above
+/// `limit_bytes` fails its operation. A `limit_bytes` of 0 disables the limit together with
+/// the tracking, so `lancedb_connection_memory_stats` then reports no usage.
+///
+/// # Safety
+/// - `builder` must be a valid pointer returned from `lancedb_connect`
+/// - `builder` will be consumed and must not be used after calling this function
+///
+/// # Returns
+/// - A new pointer to LanceDBConnectBuilder on success
+/// - Null pointer on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_connect_builder_memory_limit(
+    builder: *mut LanceDBConnectBuilder,
+    limit_bytes: usize,
+) -> *mut LanceDBConnectBuilder {
+    if builder.is_null() {
+        return ptr::null_mut();
+    }
+
+    let mut builder_box = Box::from_raw(builder);
+    builder_box.options.memory_limit = limit_bytes;
+    Box::into_raw(builder_box)
+}
+
 /// Free a ConnectBuilder
 ///
 /// # Safety
@@ -199,6 +865,30 @@ pub unsafe extern "C" fn lancedb_connection_uri(
     cached_uri.as_ptr()
 }
 
+/// Get the memory usage of the connection
+///
+/// # Safety
+/// - `connection` must be a valid pointer returned from `lancedb_connect_builder_execute`
+/// - `stats_out` must be a valid pointer to receive the memory usage
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_connection_memory_stats(
+    connection: *const LanceDBConnection,
+    stats_out: *mut LanceDBMemoryStats,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if connection.is_null() || stats_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    *stats_out = (*connection).memory.stats();
+    LanceDBError::Success
+}
+
 /// Create a new table with Arrow schema and data
 ///
 /// # Safety
@@ -231,9 +921,8 @@ pub unsafe extern "C" fn lancedb_table_create(
     };
 
     let conn = &(*connection).inner;
-    let runtime = get_runtime();
 
-    match runtime.block_on(async {
+    match block_on(c"table_create", async {
         // Import schema from Arrow C ABI
         let schema = match Schema::try_from(&*schema_ptr) {
             Ok(s) => Arc::new(s),
@@ -254,7 +943,7 @@ pub unsafe extern "C" fn lancedb_table_create(
         } else {
             // Take ownership of the reader
             let reader_box = Box::from_raw(reader);
-            reader_box.into_inner()
+            (*connection).memory.track_reader(reader_box.into_inner())
         };
 
         conn.create_table(table_name_str, batch_reader)
@@ -262,8 +951,10 @@ pub unsafe extern "C" fn lancedb_table_create(
             .await
     }) {
         Ok(table) => {
-            let boxed_table = Box::new(LanceDBTable { inner: table });
-            *table_out = Box::into_raw(boxed_table);
+            let table = (*connection).new_table(table);
+            let mut table_cache = (*connection).table_cache.lock().unwrap();
+            table_cache.insert(table_name_str, &table);
+            *table_out = Box::into_raw(Box::new(table));
             LanceDBError::Success
         }
         Err(e) => handle_error(&e, error_message),
@@ -294,9 +985,8 @@ pub unsafe extern "C" fn lancedb_connection_table_names(
     }
 
     let conn = &(*connection).inner;
-    let runtime = get_runtime();
 
-    match runtime.block_on(conn.table_names().execute()) {
+    match block_on(c"connection_table_names", conn.table_names().execute()) {
         Ok(names) => {
             let count = names.len();
             *count_out = count;
@@ -484,9 +1174,10 @@ pub unsafe extern "C" fn lancedb_table_names_builder_execute(
 
     let table_names_builder = *builder_box.inner;
 
-    let runtime = get_runtime();
-
-    match runtime.block_on(table_names_builder.execute()) {
+    match block_on(
+        c"table_names_builder_execute",
+        table_names_builder.execute(),
+    ) {
         Ok(names) => {
             let count = names.len();
             *count_out = count;
@@ -582,12 +1273,25 @@ pub unsafe extern "C" fn lancedb_connection_open_table(
     };
 
     let conn = &(*connection).inner;
-    let runtime = get_runtime();
 
-    match runtime.block_on(conn.open_table(table_name_str).execute()) {
+    if let Some(table) = (*connection)
+        .table_cache
+        .lock()
+        .unwrap()
+        .get(table_name_str)
+    {
+        return Box::into_raw(Box::new(table));
+    }
+
+    match block_on(
+        c"connection_open_table",
+        conn.open_table(table_name_str).execute(),
+    ) {
         Ok(table) => {
-            let boxed_table = Box::new(LanceDBTable { inner: table });
-            Box::into_raw(boxed_table)
+            let table = (*connection).new_table(table);
+            let mut table_cache = (*connection).table_cache.lock().unwrap();
+            table_cache.insert(table_name_str, &table);
+            Box::into_raw(Box::new(table))
         }
         Err(_) => ptr::null_mut(),
     }
@@ -621,17 +1325,27 @@ pub unsafe extern "C" fn lancedb_connection_drop_table(
     };
 
     let conn = &(*connection).inner;
-    let runtime = get_runtime();
 
     let result = if namespace.is_null() {
-        runtime.block_on(conn.drop_table(table_name_str, &[]))
+        block_on(
+            c"connection_drop_table",
+            conn.drop_table(table_name_str, &[]),
+        )
     } else {
         let Ok(namespace_str) = CStr::from_ptr(namespace).to_str() else {
             set_invalid_argument_message(error_message);
             return LanceDBError::InvalidArgument;
         };
-        runtime.block_on(conn.drop_table(table_name_str, &[String::from(namespace_str)]))
+        block_on(
+            c"connection_drop_table",
+            conn.drop_table(table_name_str, &[String::from(namespace_str)]),
+        )
     };
+    (*connection)
+        .table_cache
+        .lock()
+        .unwrap()
+        .remove(table_name_str);
 
     match result {
         Ok(_) => LanceDBError::Success,
@@ -674,7 +1388,6 @@ pub unsafe extern "C" fn lancedb_connection_rename_table(
     };
 
     let conn = &(*connection).inner;
-    let runtime = get_runtime();
 
     let cur_namespace_vec = if cur_namespace.is_null() {
         Vec::new()
@@ -696,12 +1409,22 @@ pub unsafe extern "C" fn lancedb_connection_rename_table(
         vec![String::from(new_namespace_str)]
     };
 
-    match runtime.block_on(conn.rename_table(
-        old_name_str,
-        new_name_str,
-        &cur_namespace_vec,
-        &new_namespace_vec,
-    )) {
+    // Cached handles would keep pointing at the old location
+    {
+        let mut table_cache = (*connection).table_cache.lock().unwrap();
+        table_cache.remove(old_name_str);
+        table_cache.remove(new_name_str);
+    }
+
+    match block_on(
+        c"connection_rename_table",
+        conn.rename_table(
+            old_name_str,
+            new_name_str,
+            &cur_namespace_vec,
+            &new_namespace_vec,
+        ),
+    ) {
         Ok(_) => LanceDBError::Success,
         Err(e) => handle_error(&e, error_message),
     }
@@ -728,17 +1451,20 @@ pub unsafe extern "C" fn lancedb_connection_drop_all_tables(
     }
 
     let conn = &(*connection).inner;
-    let runtime = get_runtime();
 
     let result = if namespace.is_null() {
-        runtime.block_on(conn.drop_all_tables(&[]))
+        block_on(c"connection_drop_all_tables", conn.drop_all_tables(&[]))
     } else {
         let Ok(namespace_str) = CStr::from_ptr(namespace).to_str() else {
             set_invalid_argument_message(error_message);
             return LanceDBError::InvalidArgument;
         };
-        runtime.block_on(conn.drop_all_tables(&[String::from(namespace_str)]))
+        block_on(
+            c"connection_drop_all_tables",
+            conn.drop_all_tables(&[String::from(namespace_str)]),
+        )
     };
+    (*connection).table_cache.lock().unwrap().clear();
 
     match result {
         Ok(_) => LanceDBError::Success,
@@ -772,12 +1498,14 @@ pub unsafe extern "C" fn lancedb_connection_create_namespace(
     };
 
     let conn = &(*connection).inner;
-    let runtime = get_runtime();
 
     let request = CreateNamespaceRequest {
         namespace: vec![namespace_str.to_string()],
     };
-    match runtime.block_on(conn.create_namespace(request)) {
+    match block_on(
+        c"connection_create_namespace",
+        conn.create_namespace(request),
+    ) {
         Ok(_) => LanceDBError::Success,
         Err(e) => handle_error(&e, error_message),
     }
@@ -809,12 +1537,11 @@ pub unsafe extern "C" fn lancedb_connection_drop_namespace(
     };
 
     let conn = &(*connection).inner;
-    let runtime = get_runtime();
 
     let request = DropNamespaceRequest {
         namespace: vec![namespace_str.to_string()],
     };
-    match runtime.block_on(conn.drop_namespace(request)) {
+    match block_on(c"connection_drop_namespace", conn.drop_namespace(request)) {
         Ok(_) => LanceDBError::Success,
         Err(e) => handle_error(&e, error_message),
     }
@@ -856,14 +1583,13 @@ pub unsafe extern "C" fn lancedb_connection_list_namespaces(
     };
 
     let conn = &(*connection).inner;
-    let runtime = get_runtime();
 
     let request = ListNamespacesRequest {
         namespace: parent_namespace,
         page_token: None,
         limit: None,
     };
-    match runtime.block_on(conn.list_namespaces(request)) {
+    match block_on(c"connection_list_namespaces", conn.list_namespaces(request)) {
         Ok(namespaces) => {
             let count = namespaces.len();
             *count_out = count;
@@ -0,0 +1,244 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The LanceDB Authors
+
+//! Fragment-level table access for LanceDB C bindings
+//!
+//! A table version is a list of fragments, each holding a disjoint set of rows. Listing
+//! the fragments of a pinned version and restricting queries to subsets of them lets
+//! callers split a full scan across threads or machines without gaps or double reads.
+//! Fragments are read through a Lance dataset opened at that version, because lancedb
+//! queries always run against the latest version of the whole table.
+
+use std::collections::HashMap;
+use std::os::raw::c_char;
+use std::ptr;
+use std::sync::Arc;
+
+use futures::TryStreamExt;
+use lance::dataset::builder::DatasetBuilder;
+use lance::dataset::scanner::Scanner;
+use lance::dataset::Dataset;
+use lance::session::Session;
+use lance::table::format::Fragment;
+use lancedb::arrow::{SendableRecordBatchStream, SimpleRecordBatchStream};
+use lancedb::query::Select;
+use lancedb::Table;
+
+use crate::connection::{block_on, LanceDBTable};
+use crate::error::{
+    handle_error, set_invalid_argument_message, set_unknown_error_message, LanceDBError,
+};
+
+/// Fragment of a table version
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct LanceDBFragmentInfo {
+    pub id: u64,               // Fragment ID, stable across versions
+    pub num_rows: u64,         // Rows in the fragment, excluding deleted rows
+    pub num_deleted_rows: u64, // Rows marked as deleted
+    pub size_bytes: u64,       // Size of the data files (0 if not recorded)
+}
+
+/// Query restricted to fragments of a pinned table version
+#[derive(Clone)]
+pub(crate) struct FragmentScan {
+    dataset: Arc<Dataset>,
+    fragments: Vec<Fragment>,
+}
+
+/// Settings of the connection for datasets opened directly through Lance
+#[derive(Debug, Default)]
+pub(crate) struct DatasetOptions {
+    pub(crate) storage_options: HashMap<String, String>,
+    // Lance session of the connection, None for the default session
+    pub(crate) session: Option<Arc<Session>>,
+}
+
+/// Open the dataset of a local table at `version` (0 = current version)
+pub(crate) async fn open_dataset(
+    tbl: &Table,
+    options: &DatasetOptions,
+    version: u64,
+) -> lancedb::error::Result<Dataset> {
+    let Some(native) = tbl.as_native() else {
+        return Err(lancedb::error::Error::NotSupported {
+            message: "fragment access is only available for local tables".to_string(),
+        });
+    };
+
+    let version = if version == 0 {
+        tbl.version().await?
+    } else {
+        version
+    };
+
+    let mut builder = DatasetBuilder::from_uri(native.dataset_uri())
+        .with_version(version)
+        .with_storage_options(options.storage_options.clone());
+    if let Some(session) = &options.session {
+        builder = builder.with_session(session.clone());
+    }
+    Ok(builder.load().await?)
+}
+
+impl FragmentScan {
+    /// Look up the given fragments in the dataset of `version`
+    pub(crate) async fn new(
+        tbl: &Table,
+        options: &DatasetOptions,
+        version: u64,
+        fragment_ids: &[u64],
+    ) -> lancedb::error::Result<Self> {
+        let dataset = open_dataset(tbl, options, version).await?;
+        let fragments = fragment_ids
+            .iter()
+            .map(|id| {
+                dataset
+                    .get_fragment(*id as usize)
+                    .map(|fragment| fragment.metadata().clone())
+                    .ok_or_else(|| lancedb::error::Error::InvalidInput {
+                        message: format!(
+                            "fragment {id} does not exist in version {}",
+                            dataset.version().version
+                        ),
+                    })
+            })
+            .collect::<lancedb::error::Result<Vec<_>>>()?;
+
+        Ok(Self {
+            dataset: Arc::new(dataset),
+            fragments,
+        })
+    }
+
+    /// Scanner over the fragments with the options of a query
+    pub(crate) fn scanner(
+        &self,
+        limit: Option<usize>,
+        offset: Option<usize>,
+        select: Option<&Select>,
+        filter: Option<&str>,
+    ) -> lancedb::error::Result<Scanner> {
+        let mut scanner = self.dataset.scan();
+        scanner.with_fragments(self.fragments.clone());
+
+        match select {
+            None | Some(Select::All) => {}
+            Some(Select::Columns(columns)) => {
+                scanner.project(columns)?;
+            }
+            Some(Select::Dynamic(columns)) => {
+                scanner.project_with_transform(columns)?;
+            }
+        }
+        if let Some(filter) = filter {
+            scanner.filter(filter)?;
+        }
+        if limit.is_some() || offset.is_some() {
+            scanner.limit(limit.map(|l| l as i64), offset.map(|o| o as i64))?;
+        }
+
+        Ok(scanner)
+    }
+}
+
+/// Execute a scanner as a lancedb record batch stream
+pub(crate) async fn execute_scanner(
+    scanner: Scanner,
+) -> lancedb::error::Result<SendableRecordBatchStream> {
+    let schema = scanner.schema().await?;
+    let stream = scanner
+        .try_into_stream()
+        .await?
+        .map_err(lancedb::error::Error::from);
+    Ok(Box::pin(SimpleRecordBatchStream::new(stream, schema)))
+}
+
+/// Information of all fragments of a dataset
+async fn fragment_infos(dataset: &Dataset) -> lancedb::error::Result<Vec<LanceDBFragmentInfo>> {
+    let mut infos = Vec::new();
+    for fragment in dataset.get_fragments() {
+        let size_bytes = fragment
+            .metadata()
+            .files
+            .iter()
+            .map(|file| file.file_size_bytes.get().map_or(0, |size| size.get()))
+            .sum();
+        infos.push(LanceDBFragmentInfo {
+            id: fragment.id() as u64,
+            num_rows: fragment.count_rows(None).await? as u64,
+            num_deleted_rows: fragment.count_deletions().await? as u64,
+            size_bytes,
+        });
+    }
+    Ok(infos)
+}
+
+/// List the fragments of a table version
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `fragments_out` must be a valid pointer to receive the fragment array
+/// - `count_out` must be a valid pointer to receive the number of fragments
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - The array must be freed with `lancedb_free_fragment_list`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_list_fragments(
+    table: *const LanceDBTable,
+    version: u64,
+    fragments_out: *mut *mut LanceDBFragmentInfo,
+    count_out: *mut usize,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if table.is_null() || fragments_out.is_null() || count_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let tbl = &(*table).inner;
+    let options = &(*table).dataset_options;
+
+    let infos = block_on(c"table_list_fragments", async {
+        let dataset = open_dataset(tbl, options, version).await?;
+        fragment_infos(&dataset).await
+    });
+
+    match infos {
+        Ok(infos) => {
+            let count = infos.len();
+            *count_out = count;
+
+            if count == 0 {
+                *fragments_out = ptr::null_mut();
+                return LanceDBError::Success;
+            }
+
+            let fragments_array = libc::malloc(count * std::mem::size_of::<LanceDBFragmentInfo>())
+                as *mut LanceDBFragmentInfo;
+            if fragments_array.is_null() {
+                *count_out = 0;
+                set_unknown_error_message(error_message);
+                return LanceDBError::Unknown;
+            }
+            ptr::copy_nonoverlapping(infos.as_ptr(), fragments_array, count);
+
+            *fragments_out = fragments_array;
+            LanceDBError::Success
+        }
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
+/// Free fragment array returned by `lancedb_table_list_fragments`
+///
+/// # Safety
+/// - `fragments` must be a pointer returned from `lancedb_table_list_fragments` or NULL
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_free_fragment_list(fragments: *mut LanceDBFragmentInfo) {
+    if !fragments.is_null() {
+        libc::free(fragments as *mut libc::c_void);
+    }
+}
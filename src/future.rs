@@ -0,0 +1,409 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The LanceDB Authors
+
+//! Asynchronous operation FFI functions for LanceDB C bindings
+//!
+//! The `_async` variants spawn the operation on the shared tokio runtime and return
+//! immediately with a future handle. Completion can be observed with a callback,
+//! by polling `lancedb_future_is_ready`, or by blocking in one of the `lancedb_future_get*`
+//! functions.
+
+use std::ffi::CStr;
+use std::future::Future;
+use std::os::raw::{c_char, c_int, c_void};
+use std::panic::AssertUnwindSafe;
+use std::ptr;
+use std::sync::{Arc, Mutex};
+
+use futures::FutureExt;
+use lancedb::arrow::SendableRecordBatchStream;
+use tokio::task::JoinHandle;
+
+use crate::connection::{get_runtime, LanceDBTable};
+use crate::error::{handle_error, set_invalid_argument_message, LanceDBError};
+use crate::metrics::Span;
+use crate::query::{
+    execute_query, execute_vector_query, new_query_result, LanceDBQuery, LanceDBQueryResult,
+    LanceDBVectorQuery,
+};
+use crate::table::{add, merge_insert, on_columns_from_c, MergeInsertOptions};
+use crate::types::{LanceDBMergeInsertConfig, LanceDBRecordBatchReader};
+
+/// Completion callback for asynchronous operations
+///
+/// Invoked once from a runtime worker thread after the operation finished, failed,
+/// panicked or was cancelled.
+pub type LanceDBCompletionCallback = Option<unsafe extern "C" fn(user_data: *mut c_void)>;
+
+/// Value produced by a finished asynchronous operation
+enum FutureOutput {
+    Unit,
+    QueryResult(SendableRecordBatchStream),
+}
+
+type FutureSlot = Arc<Mutex<Option<lancedb::error::Result<FutureOutput>>>>;
+
+/// Opaque handle to an asynchronous operation
+#[repr(C)]
+pub struct LanceDBFuture {
+    slot: FutureSlot,
+    handle: JoinHandle<()>,
+}
+
+/// Callback and user data pair moved onto the runtime
+///
+/// Publishes the output and notifies the caller exactly once. If the task is dropped
+/// before that, because it was cancelled, a cancellation error is published instead so
+/// that waiters and the callback are never left hanging.
+struct Completion {
+    slot: FutureSlot,
+    callback: LanceDBCompletionCallback,
+    user_data: *mut c_void,
+    done: bool,
+}
+
+// The user data pointer is only handed back to the caller's callback
+unsafe impl Send for Completion {}
+
+impl Completion {
+    fn complete(&mut self, output: lancedb::error::Result<FutureOutput>) {
+        self.done = true;
+        // Publish the output before notifying, so the callback can fetch it without blocking
+        {
+            let mut slot = self.slot.lock().unwrap_or_else(|e| e.into_inner());
+            if slot.is_none() {
+                *slot = Some(output);
+            }
+        }
+        if let Some(callback) = self.callback {
+            unsafe { callback(self.user_data) };
+        }
+    }
+}
+
+impl Drop for Completion {
+    fn drop(&mut self) {
+        if !self.done {
+            self.complete(Err(lancedb::error::Error::Runtime {
+                message: "Asynchronous operation was cancelled".to_string(),
+            }));
+        }
+    }
+}
+
+/// Spawn an operation on the shared runtime and wrap it in a future handle
+fn spawn_future<F>(
+    name: &'static CStr,
+    operation: F,
+    callback: LanceDBCompletionCallback,
+    user_data: *mut c_void,
+) -> *mut LanceDBFuture
+where
+    F: Future<Output = lancedb::error::Result<FutureOutput>> + Send + 'static,
+{
+    let slot: FutureSlot = Arc::new(Mutex::new(None));
+    let mut completion = Completion {
+        slot: slot.clone(),
+        callback,
+        user_data,
+        done: false,
+    };
+
+    let handle = get_runtime().spawn(async move {
+        let span = Span::start(name);
+        // A panic must not unwind into the runtime and leave the future unresolved
+        let output = AssertUnwindSafe(operation)
+            .catch_unwind()
+            .await
+            .unwrap_or_else(|_| {
+                Err(lancedb::error::Error::Runtime {
+                    message: "Asynchronous operation panicked".to_string(),
+                })
+            });
+        span.finish(output.is_err());
+        completion.complete(output);
+    });
+
+    Box::into_raw(Box::new(LanceDBFuture { slot, handle }))
+}
+
+/// Wait for the operation to finish and take its output
+unsafe fn take_output(future: *mut LanceDBFuture) -> lancedb::error::Result<FutureOutput> {
+    let mut future_box = Box::from_raw(future);
+
+    let ready = future_box.slot.lock().unwrap().take();
+    if let Some(output) = ready {
+        return output;
+    }
+
+    // Blocking a runtime thread (e.g. from a completion callback) would panic or deadlock
+    if tokio::runtime::Handle::try_current().is_ok() {
+        future_box.handle.abort();
+        return Err(lancedb::error::Error::Runtime {
+            message: "Cannot wait for an unfinished asynchronous operation on a LanceDB runtime \
+                      thread"
+                .to_string(),
+        });
+    }
+
+    // Not finished yet; block until the task (including the callback) is done
+    if let Err(e) = get_runtime().block_on(&mut future_box.handle) {
+        return Err(lancedb::error::Error::Runtime {
+            message: format!("Asynchronous operation failed: {e}"),
+        });
+    }
+
+    let output = future_box.slot.lock().unwrap().take();
+    output.unwrap_or_else(|| {
+        Err(lancedb::error::Error::Runtime {
+            message: "Asynchronous operation produced no result".to_string(),
+        })
+    })
+}
+
+/// Execute query asynchronously
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_query_new`
+/// - This function consumes the query pointer; do not use it after calling
+/// - `callback` can be NULL; otherwise it must be safe to call from any thread with `user_data`
+///
+/// # Returns
+/// - Non-null pointer to LanceDBFuture; resolve it with `lancedb_future_get_query_result`
+/// - Null pointer if `query` is NULL
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_query_execute_async(
+    query: *mut LanceDBQuery,
+    callback: LanceDBCompletionCallback,
+    user_data: *mut c_void,
+) -> *mut LanceDBFuture {
+    if query.is_null() {
+        return ptr::null_mut();
+    }
+
+    let query_box = Box::from_raw(query);
+    spawn_future(
+        c"query_execute_async",
+        async move {
+            execute_query(*query_box)
+                .await
+                .map(FutureOutput::QueryResult)
+        },
+        callback,
+        user_data,
+    )
+}
+
+/// Execute vector query asynchronously
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_vector_query_new`
+/// - This function consumes the query pointer; do not use it after calling
+/// - `callback` can be NULL; otherwise it must be safe to call from any thread with `user_data`
+///
+/// # Returns
+/// - Non-null pointer to LanceDBFuture; resolve it with `lancedb_future_get_query_result`
+/// - Null pointer if `query` is NULL
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_execute_async(
+    query: *mut LanceDBVectorQuery,
+    callback: LanceDBCompletionCallback,
+    user_data: *mut c_void,
+) -> *mut LanceDBFuture {
+    if query.is_null() {
+        return ptr::null_mut();
+    }
+
+    let query_box = Box::from_raw(query);
+    spawn_future(
+        c"vector_query_execute_async",
+        async move {
+            execute_vector_query(*query_box)
+                .await
+                .map(FutureOutput::QueryResult)
+        },
+        callback,
+        user_data,
+    )
+}
+
+/// Add data to table asynchronously
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `reader` must be a valid pointer to LanceDBRecordBatchReader; it is consumed
+/// - `callback` can be NULL; otherwise it must be safe to call from any thread with `user_data`
+///
+/// # Returns
+/// - Non-null pointer to LanceDBFuture; resolve it with `lancedb_future_get`
+/// - Null pointer if `table` or `reader` is NULL
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_add_async(
+    table: *const LanceDBTable,
+    reader: *mut LanceDBRecordBatchReader,
+    callback: LanceDBCompletionCallback,
+    user_data: *mut c_void,
+) -> *mut LanceDBFuture {
+    if table.is_null() || reader.is_null() {
+        return ptr::null_mut();
+    }
+
+    let tbl = (*table).inner.clone();
+    let snapshot = (*table).snapshot.clone();
+    let reader_box = Box::from_raw(reader);
+    let data = (*table).memory.track_reader(reader_box.into_inner());
+    spawn_future(
+        c"table_add_async",
+        async move {
+            let result = add(tbl, data, None).await;
+            snapshot.invalidate();
+            result.map(|_| FutureOutput::Unit)
+        },
+        callback,
+        user_data,
+    )
+}
+
+/// Merge insert data into table asynchronously
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `data` must be a valid pointer to LanceDBRecordBatchReader; it is consumed on success
+/// - `on_columns` must be an array of valid null-terminated C strings containing column names
+/// - `num_columns` must match the actual number of columns in the array
+/// - `config` can be NULL for default upsert behavior
+/// - `callback` can be NULL; otherwise it must be safe to call from any thread with `user_data`
+///
+/// # Returns
+/// - Non-null pointer to LanceDBFuture; resolve it with `lancedb_future_get`
+/// - Null pointer on invalid arguments (the reader is not consumed in that case)
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_merge_insert_async(
+    table: *const LanceDBTable,
+    data: *mut LanceDBRecordBatchReader,
+    on_columns: *const *const c_char,
+    num_columns: usize,
+    config: *const LanceDBMergeInsertConfig,
+    callback: LanceDBCompletionCallback,
+    user_data: *mut c_void,
+) -> *mut LanceDBFuture {
+    if table.is_null() || data.is_null() || on_columns.is_null() || num_columns == 0 {
+        return ptr::null_mut();
+    }
+
+    let Some(column_names) = on_columns_from_c(on_columns, num_columns) else {
+        return ptr::null_mut();
+    };
+
+    // Copy the configuration, the caller's strings need not outlive this call
+    let Some(options) = MergeInsertOptions::from_c(config) else {
+        return ptr::null_mut();
+    };
+
+    let tbl = (*table).inner.clone();
+    let snapshot = (*table).snapshot.clone();
+    let data_box = Box::from_raw(data);
+    let data = (*table).memory.track_reader(data_box.into_inner());
+
+    spawn_future(
+        c"table_merge_insert_async",
+        async move {
+            let result = merge_insert(tbl, data, column_names, options).await;
+            snapshot.invalidate();
+            result.map(|_| FutureOutput::Unit)
+        },
+        callback,
+        user_data,
+    )
+}
+
+/// Check whether an asynchronous operation has finished
+///
+/// # Safety
+/// - `future` must be a valid pointer returned from an `_async` function
+///
+/// # Returns
+/// - 1 if the result is available, 0 otherwise (or if `future` is NULL)
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_future_is_ready(future: *const LanceDBFuture) -> c_int {
+    if future.is_null() {
+        return 0;
+    }
+
+    (*future).slot.lock().unwrap().is_some() as c_int
+}
+
+/// Wait for an asynchronous operation without a result value and get its status
+///
+/// # Safety
+/// - `future` must be a valid pointer returned from `lancedb_table_add_async` or
+///   `lancedb_table_merge_insert_async`
+/// - This function consumes the future pointer; do not use it after calling
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code of the finished operation
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_future_get(
+    future: *mut LanceDBFuture,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if future.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    match take_output(future) {
+        Ok(_) => LanceDBError::Success,
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
+/// Wait for an asynchronous query and get its result
+///
+/// # Safety
+/// - `future` must be a valid pointer returned from `lancedb_query_execute_async` or
+///   `lancedb_vector_query_execute_async`
+/// - This function consumes the future pointer; do not use it after calling
+/// - `result_out` must be a valid pointer to receive the query result
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code of the finished query
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_future_get_query_result(
+    future: *mut LanceDBFuture,
+    result_out: *mut *mut LanceDBQueryResult,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if future.is_null() || result_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    *result_out = ptr::null_mut();
+    match take_output(future) {
+        Ok(FutureOutput::QueryResult(stream)) => {
+            *result_out = new_query_result(stream);
+            LanceDBError::Success
+        }
+        Ok(FutureOutput::Unit) => {
+            set_invalid_argument_message(error_message);
+            LanceDBError::InvalidArgument
+        }
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
+/// Free a future, cancelling the operation if it is still running
+///
+/// # Safety
+/// - `future` must be a valid pointer returned from an `_async` function
+/// - `future` must not be used after calling this function
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_future_free(future: *mut LanceDBFuture) {
+    if !future.is_null() {
+        let future_box = Box::from_raw(future);
+        future_box.handle.abort();
+    }
+}
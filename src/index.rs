@@ -6,6 +6,7 @@
 //! This module provides complete index management operations
 
 use std::ffi::{CStr, CString};
+use std::mem;
 use std::os::raw::{c_char, c_float, c_int};
 use std::ptr;
 
@@ -14,10 +15,12 @@ use lancedb::index::scalar::{
 };
 use lancedb::index::vector::{
     IvfFlatIndexBuilder, IvfHnswPqIndexBuilder, IvfHnswSqIndexBuilder, IvfPqIndexBuilder,
+    IvfRqIndexBuilder, IvfSqIndexBuilder,
 };
-use lancedb::index::Index;
+use lancedb::index::{Index, IndexType};
+use lancedb::table::{OptimizeAction, OptimizeOptions};
 
-use crate::connection::{get_runtime, LanceDBTable};
+use crate::connection::{block_on, LanceDBTable};
 use crate::error::{
     handle_error, set_invalid_argument_message, set_unknown_error_message, LanceDBError,
 };
@@ -36,6 +39,37 @@ pub enum LanceDBIndexType {
     IvfPq = 6,
     IvfHnswPq = 7,
     IvfHnswSq = 8,
+    IvfSq = 9,
+    IvfRq = 10,
+}
+
+impl From<&IndexType> for LanceDBIndexType {
+    fn from(index_type: &IndexType) -> Self {
+        match index_type {
+            IndexType::BTree => Self::BTree,
+            IndexType::Bitmap => Self::Bitmap,
+            IndexType::LabelList => Self::LabelList,
+            IndexType::FTS => Self::FTS,
+            IndexType::IvfFlat => Self::IvfFlat,
+            IndexType::IvfPq => Self::IvfPq,
+            IndexType::IvfHnswPq => Self::IvfHnswPq,
+            IndexType::IvfHnswSq => Self::IvfHnswSq,
+            IndexType::IvfSq => Self::IvfSq,
+            IndexType::IvfRq => Self::IvfRq,
+            // Index types without a C counterpart
+            _ => Self::Auto,
+        }
+    }
+}
+
+/// Statistics of an index
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct LanceDBIndexStats {
+    pub index_type: LanceDBIndexType, // Type of the index (AUTO if not representable)
+    pub num_indexed_rows: u64,        // Rows covered by the index
+    pub num_unindexed_rows: u64,      // Rows added since the index was built or updated
+    pub num_indices: u32, // Number of index segments, 1 + the number of deltas (0 = unknown)
 }
 
 /// Configuration for vector indices
@@ -47,7 +81,7 @@ pub struct LanceDBVectorIndexConfig {
     pub max_iterations: c_int, // Maximum training iterations (-1 = default)
     pub sample_rate: c_float,  // Sampling rate for training (0.0 = default)
     pub distance_type: LanceDBDistanceType, // Distance metric
-    pub accelerator: *const c_char, // GPU accelerator ("cuda", "mps", or NULL for CPU)
+    pub accelerator: *const c_char, // Training device ("cuda", "mps", or NULL / "cpu" for CPU)
     pub replace: c_int,        // Replace existing index (1 = true, 0 = false)
 }
 
@@ -65,6 +99,87 @@ impl Default for LanceDBVectorIndexConfig {
     }
 }
 
+/// Advanced vector index build parameters
+///
+/// Versioned by `struct_size`: fields beyond the size passed by the caller take their
+/// defaults, so callers built against an older header keep working when fields are added.
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct LanceDBVectorIndexParams {
+    pub struct_size: usize, // Size of the struct, set by lancedb_vector_index_params_init
+    pub m: u32,             // HNSW edges per node (0 = default 20)
+    pub ef_construction: u32, // HNSW candidate list size while building the graph (0 = default 300)
+    pub num_bits: u32, // PQ bits per sub-vector code, 4 or 8 (0 = default 8); RQ bits per dimension (0 = default 1)
+    pub target_partition_size: u32, // IVF rows per partition if num_partitions is auto (0 = default)
+}
+
+impl Default for LanceDBVectorIndexParams {
+    fn default() -> Self {
+        Self {
+            struct_size: mem::size_of::<Self>(),
+            m: 0,
+            ef_construction: 0,
+            num_bits: 0,
+            target_partition_size: 0,
+        }
+    }
+}
+
+impl LanceDBVectorIndexParams {
+    /// Copy the fields known to both the caller and this library
+    ///
+    /// Returns None if the caller's struct is too small to hold `struct_size`.
+    unsafe fn from_c(params: *const Self) -> Option<Self> {
+        let mut out = Self::default();
+        if params.is_null() {
+            return Some(out);
+        }
+
+        let size = (*params).struct_size;
+        if size < mem::size_of::<usize>() {
+            return None;
+        }
+        ptr::copy_nonoverlapping(
+            params as *const u8,
+            &mut out as *mut Self as *mut u8,
+            size.min(mem::size_of::<Self>()),
+        );
+        out.struct_size = mem::size_of::<Self>();
+        Some(out)
+    }
+}
+
+/// Check that the requested accelerator can train the index
+///
+/// The native index builder trains IVF centroids and PQ codebooks on the CPU only;
+/// GPU training exists in the Python `lance` package, which this library does not embed.
+/// Requesting a GPU is therefore an error rather than a silent CPU fallback.
+unsafe fn check_accelerator(accelerator: *const c_char) -> lancedb::error::Result<()> {
+    if accelerator.is_null() {
+        return Ok(());
+    }
+
+    let Ok(name) = CStr::from_ptr(accelerator).to_str() else {
+        return Err(lancedb::error::Error::InvalidInput {
+            message: "accelerator is not valid UTF-8".to_string(),
+        });
+    };
+
+    match name {
+        "" | "cpu" => Ok(()),
+        "cuda" | "mps" => Err(lancedb::error::Error::NotSupported {
+            message: format!(
+                "accelerator \"{name}\" is not available, this build only trains indices on the CPU"
+            ),
+        }),
+        _ => Err(lancedb::error::Error::InvalidInput {
+            message: format!(
+                "unknown accelerator \"{name}\", expected \"cuda\", \"mps\", \"cpu\" or NULL"
+            ),
+        }),
+    }
+}
+
 /// Configuration for scalar indices
 #[repr(C)]
 #[derive(Clone)]
@@ -121,6 +236,17 @@ pub enum LanceDBOptimizeType {
     Index = 3,
 }
 
+/// Initialize advanced vector index parameters with defaults
+///
+/// # Safety
+/// - `params` must be a valid pointer to LanceDBVectorIndexParams
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_index_params_init(params: *mut LanceDBVectorIndexParams) {
+    if !params.is_null() {
+        *params = LanceDBVectorIndexParams::default();
+    }
+}
+
 /// Create a vector index on table columns
 ///
 /// # Safety
@@ -140,12 +266,51 @@ pub unsafe extern "C" fn lancedb_table_create_vector_index(
     index_type: LanceDBIndexType,
     config: *const LanceDBVectorIndexConfig,
     error_message: *mut *mut c_char,
+) -> LanceDBError {
+    lancedb_table_create_vector_index_with_params(
+        table,
+        columns,
+        num_columns,
+        index_type,
+        config,
+        ptr::null(),
+        error_message,
+    )
+}
+
+/// Create a vector index on table columns with advanced build parameters
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `columns` must be an array of valid null-terminated C strings
+/// - `num_columns` must match the actual number of columns in the array
+/// - `config` can be NULL for defaults
+/// - `params` can be NULL for defaults; otherwise it must be initialized with
+///   `lancedb_vector_index_params_init`
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_create_vector_index_with_params(
+    table: *const LanceDBTable,
+    columns: *const *const c_char,
+    num_columns: usize,
+    index_type: LanceDBIndexType,
+    config: *const LanceDBVectorIndexConfig,
+    params: *const LanceDBVectorIndexParams,
+    error_message: *mut *mut c_char,
 ) -> LanceDBError {
     if table.is_null() || columns.is_null() || num_columns == 0 {
         set_invalid_argument_message(error_message);
         return LanceDBError::InvalidArgument;
     }
 
+    let Some(params) = LanceDBVectorIndexParams::from_c(params) else {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    };
+
     // Extract column names
     let mut column_names = Vec::with_capacity(num_columns);
     for i in 0..num_columns {
@@ -166,7 +331,6 @@ pub unsafe extern "C" fn lancedb_table_create_vector_index(
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
     // Use default config if none provided
     let cfg = if config.is_null() {
@@ -175,6 +339,10 @@ pub unsafe extern "C" fn lancedb_table_create_vector_index(
         (*config).clone()
     };
 
+    if let Err(e) = check_accelerator(cfg.accelerator) {
+        return handle_error(&e, error_message);
+    }
+
     let index = match index_type {
         LanceDBIndexType::Auto => Index::Auto,
         LanceDBIndexType::IvfFlat => {
@@ -188,10 +356,11 @@ pub unsafe extern "C" fn lancedb_table_create_vector_index(
             if cfg.sample_rate > 0.0 {
                 builder = builder.sample_rate(cfg.sample_rate as u32);
             }
+            if params.target_partition_size > 0 {
+                builder = builder.target_partition_size(params.target_partition_size);
+            }
             builder = builder.distance_type(cfg.distance_type.into());
 
-            // Note: accelerator configuration is simplified
-            let _ = cfg.accelerator;
             Index::IvfFlat(builder)
         }
         LanceDBIndexType::IvfPq => {
@@ -208,10 +377,14 @@ pub unsafe extern "C" fn lancedb_table_create_vector_index(
             if cfg.sample_rate > 0.0 {
                 builder = builder.sample_rate(cfg.sample_rate as u32);
             }
+            if params.target_partition_size > 0 {
+                builder = builder.target_partition_size(params.target_partition_size);
+            }
+            if params.num_bits > 0 {
+                builder = builder.num_bits(params.num_bits);
+            }
             builder = builder.distance_type(cfg.distance_type.into());
 
-            // Note: accelerator configuration is simplified
-            let _ = cfg.accelerator;
             Index::IvfPq(builder)
         }
         LanceDBIndexType::IvfHnswPq => {
@@ -228,10 +401,20 @@ pub unsafe extern "C" fn lancedb_table_create_vector_index(
             if cfg.sample_rate > 0.0 {
                 builder = builder.sample_rate(cfg.sample_rate as u32);
             }
+            if params.target_partition_size > 0 {
+                builder = builder.target_partition_size(params.target_partition_size);
+            }
+            if params.num_bits > 0 {
+                builder = builder.num_bits(params.num_bits);
+            }
+            if params.m > 0 {
+                builder = builder.num_edges(params.m);
+            }
+            if params.ef_construction > 0 {
+                builder = builder.ef_construction(params.ef_construction);
+            }
             builder = builder.distance_type(cfg.distance_type.into());
 
-            // Note: accelerator configuration is simplified
-            let _ = cfg.accelerator;
             Index::IvfHnswPq(builder)
         }
         LanceDBIndexType::IvfHnswSq => {
@@ -245,25 +428,74 @@ pub unsafe extern "C" fn lancedb_table_create_vector_index(
             if cfg.sample_rate > 0.0 {
                 builder = builder.sample_rate(cfg.sample_rate as u32);
             }
+            if params.target_partition_size > 0 {
+                builder = builder.target_partition_size(params.target_partition_size);
+            }
+            if params.m > 0 {
+                builder = builder.num_edges(params.m);
+            }
+            if params.ef_construction > 0 {
+                builder = builder.ef_construction(params.ef_construction);
+            }
             builder = builder.distance_type(cfg.distance_type.into());
 
-            // Note: accelerator configuration is simplified
-            let _ = cfg.accelerator;
             Index::IvfHnswSq(builder)
         }
+        LanceDBIndexType::IvfSq => {
+            let mut builder = IvfSqIndexBuilder::default();
+            if cfg.num_partitions > 0 {
+                builder = builder.num_partitions(cfg.num_partitions as u32);
+            }
+            if cfg.max_iterations > 0 {
+                builder = builder.max_iterations(cfg.max_iterations as u32);
+            }
+            if cfg.sample_rate > 0.0 {
+                builder = builder.sample_rate(cfg.sample_rate as u32);
+            }
+            if params.target_partition_size > 0 {
+                builder = builder.target_partition_size(params.target_partition_size);
+            }
+            builder = builder.distance_type(cfg.distance_type.into());
+
+            Index::IvfSq(builder)
+        }
+        LanceDBIndexType::IvfRq => {
+            let mut builder = IvfRqIndexBuilder::default();
+            if cfg.num_partitions > 0 {
+                builder = builder.num_partitions(cfg.num_partitions as u32);
+            }
+            if cfg.max_iterations > 0 {
+                builder = builder.max_iterations(cfg.max_iterations as u32);
+            }
+            if cfg.sample_rate > 0.0 {
+                builder = builder.sample_rate(cfg.sample_rate as u32);
+            }
+            if params.target_partition_size > 0 {
+                builder = builder.target_partition_size(params.target_partition_size);
+            }
+            if params.num_bits > 0 {
+                builder = builder.num_bits(params.num_bits);
+            }
+            builder = builder.distance_type(cfg.distance_type.into());
+
+            Index::IvfRq(builder)
+        }
         _ => {
             set_invalid_argument_message(error_message);
             return LanceDBError::InvalidArgument;
         }
     };
 
-    match runtime.block_on(async {
+    let result = block_on(c"table_create_vector_index", async {
         let mut index_builder = tbl.create_index(&column_names, index);
         if cfg.replace == 0 {
             index_builder = index_builder.replace(false);
         }
         index_builder.execute().await
-    }) {
+    });
+    (*table).snapshot.invalidate();
+
+    match result {
         Ok(_) => LanceDBError::Success,
         Err(e) => handle_error(&e, error_message),
     }
@@ -271,6 +503,10 @@ pub unsafe extern "C" fn lancedb_table_create_vector_index(
 
 /// Create a scalar index on table columns
 ///
+/// `BTree` suits high-cardinality columns and range filters, `Bitmap` low-cardinality
+/// columns filtered by equality or `IN`, and `LabelList` list columns filtered with
+/// `array_has_any` / `array_has_all`. `Auto` lets lancedb pick from the column type.
+///
 /// # Safety
 /// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
 /// - `columns` must be an array of valid null-terminated C strings
@@ -314,7 +550,6 @@ pub unsafe extern "C" fn lancedb_table_create_scalar_index(
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
     // Use default config if none provided
     let cfg = if config.is_null() {
@@ -324,6 +559,8 @@ pub unsafe extern "C" fn lancedb_table_create_scalar_index(
     };
 
     let index = match index_type {
+        // lancedb picks the index kind from the column type
+        LanceDBIndexType::Auto => Index::Auto,
         LanceDBIndexType::BTree => {
             let builder = BTreeIndexBuilder::default();
             // Note: force_update_statistics is not available in current API
@@ -338,13 +575,16 @@ pub unsafe extern "C" fn lancedb_table_create_scalar_index(
         }
     };
 
-    match runtime.block_on(async {
+    let result = block_on(c"table_create_scalar_index", async {
         let mut index_builder = tbl.create_index(&column_names, index);
         if cfg.replace == 0 {
             index_builder = index_builder.replace(false);
         }
         index_builder.execute().await
-    }) {
+    });
+    (*table).snapshot.invalidate();
+
+    match result {
         Ok(_) => LanceDBError::Success,
         Err(e) => handle_error(&e, error_message),
     }
@@ -394,7 +634,6 @@ pub unsafe extern "C" fn lancedb_table_create_fts_index(
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
     // Use default config if none provided
     let cfg = if config.is_null() {
@@ -434,13 +673,16 @@ pub unsafe extern "C" fn lancedb_table_create_fts_index(
 
     let index = Index::FTS(builder);
 
-    match runtime.block_on(async {
+    let result = block_on(c"table_create_fts_index", async {
         let mut index_builder = tbl.create_index(&column_names, index);
         if cfg.replace == 0 {
             index_builder = index_builder.replace(false);
         }
         index_builder.execute().await
-    }) {
+    });
+    (*table).snapshot.invalidate();
+
+    match result {
         Ok(_) => LanceDBError::Success,
         Err(e) => handle_error(&e, error_message),
     }
@@ -470,9 +712,8 @@ pub unsafe extern "C" fn lancedb_table_list_indices(
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
-    match runtime.block_on(tbl.list_indices()) {
+    match block_on(c"table_list_indices", tbl.list_indices()) {
         Ok(indices) => {
             let count = indices.len();
             *count_out = count;
@@ -517,6 +758,105 @@ pub unsafe extern "C" fn lancedb_table_list_indices(
     }
 }
 
+/// Get statistics of an index
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `index_name` must be a valid null-terminated C string
+/// - `stats_out` must be a valid pointer to receive the statistics
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - `IndexNotFound` if the table has no index with that name
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_index_stats(
+    table: *const LanceDBTable,
+    index_name: *const c_char,
+    stats_out: *mut LanceDBIndexStats,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if table.is_null() || index_name.is_null() || stats_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let Ok(index_name_str) = CStr::from_ptr(index_name).to_str() else {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    };
+
+    let tbl = &(*table).inner;
+
+    match block_on(c"table_index_stats", tbl.index_stats(index_name_str)) {
+        Ok(Some(stats)) => {
+            *stats_out = LanceDBIndexStats {
+                index_type: (&stats.index_type).into(),
+                num_indexed_rows: stats.num_indexed_rows as u64,
+                num_unindexed_rows: stats.num_unindexed_rows as u64,
+                num_indices: stats.num_indices.unwrap_or(0),
+            };
+            LanceDBError::Success
+        }
+        Ok(None) => {
+            let error = lancedb::error::Error::IndexNotFound {
+                name: index_name_str.to_string(),
+            };
+            handle_error(&error, error_message)
+        }
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
+/// Add rows appended since the index was built or updated to an index
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `index_name` must be a valid null-terminated C string
+/// - `num_indices_to_merge` is the number of existing deltas merged with the new rows
+///   (0 = write the new rows to a new delta)
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_update_index(
+    table: *const LanceDBTable,
+    index_name: *const c_char,
+    num_indices_to_merge: usize,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if table.is_null() || index_name.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let Ok(index_name_str) = CStr::from_ptr(index_name).to_str() else {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    };
+
+    let tbl = &(*table).inner;
+
+    // Reuse the trained model of the index, only the new rows are indexed
+    let options = OptimizeOptions {
+        num_indices_to_merge,
+        index_names: Some(vec![index_name_str.to_string()]),
+        ..Default::default()
+    };
+
+    let result = block_on(
+        c"table_update_index",
+        tbl.optimize(OptimizeAction::Index(options)),
+    );
+    (*table).snapshot.invalidate();
+
+    match result {
+        Ok(_) => LanceDBError::Success,
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
 /// Drop an index
 ///
 /// # Safety
@@ -543,9 +883,44 @@ pub unsafe extern "C" fn lancedb_table_drop_index(
     };
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
-    match runtime.block_on(tbl.drop_index(index_name_str)) {
+    let result = block_on(c"table_drop_index", tbl.drop_index(index_name_str));
+    (*table).snapshot.invalidate();
+
+    match result {
+        Ok(_) => LanceDBError::Success,
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
+/// Load an index into the index cache
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `index_name` must be a valid null-terminated C string
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_prewarm_index(
+    table: *const LanceDBTable,
+    index_name: *const c_char,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if table.is_null() || index_name.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let Ok(index_name_str) = CStr::from_ptr(index_name).to_str() else {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    };
+
+    let tbl = &(*table).inner;
+
+    match block_on(c"table_prewarm_index", tbl.prewarm_index(index_name_str)) {
         Ok(_) => LanceDBError::Success,
         Err(e) => handle_error(&e, error_message),
     }
@@ -571,9 +946,6 @@ pub unsafe extern "C" fn lancedb_table_optimize(
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
-
-    use lancedb::table::{OptimizeAction, OptimizeOptions};
 
     let action = match optimize_type {
         LanceDBOptimizeType::All => OptimizeAction::All,
@@ -589,7 +961,10 @@ pub unsafe extern "C" fn lancedb_table_optimize(
         LanceDBOptimizeType::Index => OptimizeAction::Index(OptimizeOptions::default()),
     };
 
-    match runtime.block_on(tbl.optimize(action)) {
+    let result = block_on(c"table_optimize", tbl.optimize(action));
+    (*table).snapshot.invalidate();
+
+    match result {
         Ok(_) => LanceDBError::Success,
         Err(e) => handle_error(&e, error_message),
     }
@@ -7,17 +7,32 @@
 //! with C and C++ applications. The API follows standard C conventions with
 //! opaque handles, explicit error codes, and manual memory management.
 
+pub mod coalesce;
 pub mod connection;
 pub mod error;
+pub mod fragment;
+pub mod future;
 pub mod index;
+pub mod maintenance;
+pub mod memory;
+pub mod metrics;
 pub mod query;
+pub mod rerank;
+pub mod store;
 pub mod table;
 pub mod types;
 
 // Re-export all public FFI functions
 pub use connection::*;
 pub use error::*;
+pub use fragment::*;
+pub use future::*;
 pub use index::*;
+pub use maintenance::*;
+pub use memory::*;
+pub use metrics::*;
 pub use query::*;
+pub use rerank::*;
+pub use store::*;
 pub use table::*;
 pub use types::*;
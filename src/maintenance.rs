@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The LanceDB Authors
+
+//! Background table maintenance for LanceDB C bindings
+//!
+//! A maintenance scheduler periodically checks its tables on the shared runtime and
+//! compacts files, updates indices and cleans up old versions once the configured
+//! thresholds are reached. Operations run one at a time with a pause in between, so
+//! maintenance never takes more than one runtime worker away from foreground queries.
+
+use std::os::raw::c_char;
+use std::ptr;
+use std::sync::{Arc, Mutex};
+use std::time::Duration;
+
+use lancedb::table::{OptimizeAction, OptimizeOptions};
+use lancedb::Table;
+use tokio::sync::watch;
+use tokio::task::JoinHandle;
+
+use crate::connection::{get_runtime, LanceDBTable};
+use crate::error::{set_invalid_argument_message, LanceDBError};
+use crate::metrics::Span;
+use crate::table::{cleanup_old_versions, compact_files};
+
+/// Maintenance scheduler configuration
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct LanceDBMaintenanceConfig {
+    pub interval_ms: u64, // Time between two maintenance passes (0 = default 60000)
+    pub pause_ms: u64,    // Pause after each maintenance operation (0 = none)
+    pub compact_min_fragments: usize, // Compact a table once it has this many fragments (0 = never)
+    pub optimize_min_unindexed_rows: usize, // Update indices once this many rows are unindexed (0 = never)
+    pub cleanup_min_versions: usize, // Clean up old versions once a table has this many versions (0 = never)
+    pub cleanup_older_than_days: u16, // Age of the versions removed by cleanup
+}
+
+const DEFAULT_INTERVAL: Duration = Duration::from_secs(60);
+
+/// Opaque handle to a maintenance scheduler
+pub struct LanceDBMaintenanceScheduler {
+    tables: Arc<Mutex<Vec<LanceDBTable>>>,
+    stop: watch::Sender<bool>,
+    handle: JoinHandle<()>,
+}
+
+/// Wait for the given duration; true if the scheduler was stopped meanwhile
+async fn stopped_within(stop: &mut watch::Receiver<bool>, duration: Duration) -> bool {
+    if *stop.borrow() {
+        return true;
+    }
+    // A dropped sender also ends the wait early
+    tokio::time::timeout(duration, stop.changed()).await.is_ok()
+}
+
+/// Whether the table has at least `min_fragments` fragments
+async fn needs_compaction(tbl: &Table, min_fragments: usize) -> lancedb::error::Result<bool> {
+    // Remote tables are maintained by the server
+    let Some(native) = tbl.as_native() else {
+        return Ok(false);
+    };
+    Ok(native.count_fragments().await >= min_fragments)
+}
+
+/// Whether any index of the table misses at least `min_unindexed_rows` rows
+async fn needs_index_update(
+    tbl: &Table,
+    min_unindexed_rows: usize,
+) -> lancedb::error::Result<bool> {
+    for index in tbl.list_indices().await? {
+        if let Some(stats) = tbl.index_stats(&index.name).await? {
+            if stats.num_unindexed_rows >= min_unindexed_rows {
+                return Ok(true);
+            }
+        }
+    }
+    Ok(false)
+}
+
+/// Run all due maintenance operations on a table; true if the scheduler was stopped
+async fn maintain(
+    table: &LanceDBTable,
+    config: &LanceDBMaintenanceConfig,
+    stop: &mut watch::Receiver<bool>,
+) -> bool {
+    let tbl = &table.inner;
+    let pause = Duration::from_millis(config.pause_ms);
+
+    if config.compact_min_fragments > 0
+        && matches!(
+            needs_compaction(tbl, config.compact_min_fragments).await,
+            Ok(true)
+        )
+    {
+        let span = Span::start(c"maintenance_compact_files");
+        let result = compact_files(tbl).await;
+        span.finish(result.is_err());
+        table.snapshot.invalidate();
+        if stopped_within(stop, pause).await {
+            return true;
+        }
+    }
+
+    if config.optimize_min_unindexed_rows > 0
+        && matches!(
+            needs_index_update(tbl, config.optimize_min_unindexed_rows).await,
+            Ok(true)
+        )
+    {
+        let span = Span::start(c"maintenance_optimize_indices");
+        let result = tbl
+            .optimize(OptimizeAction::Index(OptimizeOptions::default()))
+            .await;
+        span.finish(result.is_err());
+        table.snapshot.invalidate();
+        if stopped_within(stop, pause).await {
+            return true;
+        }
+    }
+
+    if config.cleanup_min_versions > 0
+        && matches!(
+            tbl.list_versions().await,
+            Ok(versions) if versions.len() >= config.cleanup_min_versions
+        )
+    {
+        let span = Span::start(c"maintenance_cleanup_old_versions");
+        let result = cleanup_old_versions(tbl, config.cleanup_older_than_days, false).await;
+        span.finish(result.is_err());
+        table.snapshot.invalidate();
+        if stopped_within(stop, pause).await {
+            return true;
+        }
+    }
+
+    *stop.borrow()
+}
+
+async fn run(
+    tables: Arc<Mutex<Vec<LanceDBTable>>>,
+    config: LanceDBMaintenanceConfig,
+    mut stop: watch::Receiver<bool>,
+) {
+    let interval = if config.interval_ms > 0 {
+        Duration::from_millis(config.interval_ms)
+    } else {
+        DEFAULT_INTERVAL
+    };
+
+    while !stopped_within(&mut stop, interval).await {
+        let tables = tables.lock().unwrap().clone();
+        for table in &tables {
+            if maintain(table, &config, &mut stop).await {
+                return;
+            }
+        }
+    }
+}
+
+/// Start a maintenance scheduler on the shared runtime
+///
+/// # Safety
+/// - `config` must be a valid pointer to LanceDBMaintenanceConfig
+/// - The returned pointer must be freed with `lancedb_maintenance_scheduler_free`
+///
+/// # Returns
+/// - Non-null pointer to LanceDBMaintenanceScheduler on success
+/// - Null pointer if `config` is NULL
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_maintenance_scheduler_new(
+    config: *const LanceDBMaintenanceConfig,
+) -> *mut LanceDBMaintenanceScheduler {
+    if config.is_null() {
+        return ptr::null_mut();
+    }
+
+    let tables = Arc::new(Mutex::new(Vec::new()));
+    let (stop, stop_rx) = watch::channel(false);
+    let handle = get_runtime().spawn(run(tables.clone(), *config, stop_rx));
+
+    Box::into_raw(Box::new(LanceDBMaintenanceScheduler {
+        tables,
+        stop,
+        handle,
+    }))
+}
+
+/// Add a table to the tables maintained by the scheduler
+///
+/// # Safety
+/// - `scheduler` must be a valid pointer returned from `lancedb_maintenance_scheduler_new`
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - The scheduler keeps its own handle; `table` can be freed afterwards
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_maintenance_scheduler_add_table(
+    scheduler: *const LanceDBMaintenanceScheduler,
+    table: *const LanceDBTable,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if scheduler.is_null() || table.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    (*scheduler).tables.lock().unwrap().push((*table).clone());
+    LanceDBError::Success
+}
+
+/// Stop and free a maintenance scheduler
+///
+/// # Safety
+/// - `scheduler` must be a valid pointer returned from `lancedb_maintenance_scheduler_new`
+/// - `scheduler` must not be used after calling this function
+/// - Blocks until a running maintenance operation has finished, unless called from a
+///   runtime thread (e.g. a future callback), where blocking would panic; the stopped
+///   scheduler then finishes its running operation in the background
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_maintenance_scheduler_free(
+    scheduler: *mut LanceDBMaintenanceScheduler,
+) {
+    if scheduler.is_null() {
+        return;
+    }
+
+    let scheduler_box = Box::from_raw(scheduler);
+    let _ = scheduler_box.stop.send(true);
+    // Dropping the handle detaches the task, which exits once it sees the stop signal
+    if tokio::runtime::Handle::try_current().is_err() {
+        let _ = get_runtime().block_on(scheduler_box.handle);
+    }
+}
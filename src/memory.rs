@@ -0,0 +1,284 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The LanceDB Authors
+
+//! Memory accounting for LanceDB C bindings
+//!
+//! Every record batch entering or leaving the bindings is charged to the memory pool of
+//! its connection: query results on their way to the caller and ingested batches on their
+//! way into Lance. The charge is tied to the batch's Arrow buffers and released when the
+//! last of them is dropped, whether by Lance after writing or by the caller releasing an
+//! exported array, so the pool tracks the memory that is actually still alive.
+//!
+//! A batch that would take the pool above its limit fails the operation instead of being
+//! allocated further, which turns an out-of-memory kill into an error for one request.
+//! Without a limit batches pass through untouched, so unlimited connections pay nothing.
+//!
+//! A batch is charged for the bytes its arrays reference rather than the capacity of their
+//! buffers: slices of one large batch share its buffers, and charging each slice the whole
+//! allocation would count the same memory once per slice.
+
+use std::ptr::NonNull;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::Arc;
+
+use arrow::buffer::{BooleanBuffer, Buffer, NullBuffer};
+use arrow::datatypes::ArrowNativeType;
+use arrow_array::{make_array, Array, RecordBatch, RecordBatchOptions, RecordBatchReader};
+use arrow_data::ArrayData;
+use arrow_schema::{ArrowError, DataType, SchemaRef};
+use futures::StreamExt;
+use lancedb::arrow::{SendableRecordBatchStream, SimpleRecordBatchStream};
+
+/// Memory usage of a connection
+#[repr(C)]
+#[derive(Debug, Copy, Clone, Default)]
+pub struct LanceDBMemoryStats {
+    pub current_bytes: usize, // Bytes of tracked batches still alive
+    pub peak_bytes: usize,    // Highest current_bytes since the connection was created
+    pub limit_bytes: usize,   // Configured limit (0 = unlimited)
+}
+
+/// Memory pool of a connection
+#[derive(Debug, Default)]
+pub(crate) struct MemoryPool {
+    limit: usize, // 0 = unlimited
+    current: AtomicUsize,
+    peak: AtomicUsize,
+}
+
+/// Bytes charged to a pool, released on drop
+#[derive(Debug)]
+struct Reservation {
+    pool: Arc<MemoryPool>,
+    bytes: usize,
+}
+
+impl Drop for Reservation {
+    fn drop(&mut self) {
+        self.pool.current.fetch_sub(self.bytes, Ordering::Relaxed);
+    }
+}
+
+impl MemoryPool {
+    pub(crate) fn new(limit: usize) -> Self {
+        Self {
+            limit,
+            ..Self::default()
+        }
+    }
+
+    pub(crate) fn stats(&self) -> LanceDBMemoryStats {
+        LanceDBMemoryStats {
+            current_bytes: self.current.load(Ordering::Relaxed),
+            peak_bytes: self.peak.load(Ordering::Relaxed),
+            limit_bytes: self.limit,
+        }
+    }
+
+    /// Charge `bytes` to the pool, failing if that would exceed the limit
+    fn reserve(self: &Arc<Self>, bytes: usize) -> Result<Reservation, String> {
+        let mut current = self.current.load(Ordering::Relaxed);
+        loop {
+            let next = current.saturating_add(bytes);
+            if self.limit > 0 && next > self.limit {
+                return Err(format!(
+                    "memory limit exceeded: {bytes} bytes requested with {current} of {} bytes in use",
+                    self.limit
+                ));
+            }
+            match self.current.compare_exchange_weak(
+                current,
+                next,
+                Ordering::Relaxed,
+                Ordering::Relaxed,
+            ) {
+                Ok(_) => {
+                    self.peak.fetch_max(next, Ordering::Relaxed);
+                    return Ok(Reservation {
+                        pool: self.clone(),
+                        bytes,
+                    });
+                }
+                Err(actual) => current = actual,
+            }
+        }
+    }
+
+    /// Charge a batch to the pool until all of its buffers are dropped
+    fn track_batch(self: &Arc<Self>, batch: RecordBatch) -> Result<RecordBatch, String> {
+        if self.limit == 0 {
+            return Ok(batch);
+        }
+        let columns: Vec<ArrayData> = batch.columns().iter().map(|c| c.to_data()).collect();
+        let bytes = columns.iter().map(slice_memory_size).sum();
+        let reservation = Arc::new(self.reserve(bytes)?);
+        let columns = columns
+            .into_iter()
+            .map(|column| make_array(track_array(column, &reservation)))
+            .collect();
+        let options = RecordBatchOptions::new().with_row_count(Some(batch.num_rows()));
+        RecordBatch::try_new_with_options(batch.schema(), columns, &options)
+            .map_err(|e| e.to_string())
+    }
+
+    /// Charge a single batch to the pool until all of its buffers are dropped
+    pub(crate) fn track(
+        self: &Arc<Self>,
+        batch: RecordBatch,
+    ) -> lancedb::error::Result<RecordBatch> {
+        self.track_batch(batch)
+            .map_err(|message| lancedb::error::Error::Runtime { message })
+    }
+
+    /// Stream charging each batch of `stream` to the pool
+    pub(crate) fn track_stream(
+        self: &Arc<Self>,
+        stream: SendableRecordBatchStream,
+    ) -> SendableRecordBatchStream {
+        if self.limit == 0 {
+            return stream;
+        }
+        let schema = stream.schema();
+        let pool = self.clone();
+        Box::pin(SimpleRecordBatchStream::new(
+            stream.map(move |batch| pool.track(batch?)),
+            schema,
+        ))
+    }
+
+    /// Reader charging each batch of `reader` to the pool
+    pub(crate) fn track_reader(
+        self: &Arc<Self>,
+        reader: Box<dyn RecordBatchReader + Send>,
+    ) -> Box<dyn RecordBatchReader + Send> {
+        if self.limit == 0 {
+            return reader;
+        }
+        Box::new(TrackedReader {
+            pool: self.clone(),
+            inner: reader,
+        })
+    }
+}
+
+/// Bytes of the buffers `data` references, falling back to their capacity for layouts
+/// arrow cannot size by slice
+///
+/// Nested children are sized over the rows the parent references: arrays imported through
+/// the C data interface keep the children of a sliced parent whole, which arrow's own
+/// `get_slice_memory_size` would charge in full.
+fn slice_memory_size(data: &ArrayData) -> usize {
+    let nulls = data.nulls().map_or(0, |nulls| nulls.len().div_ceil(8));
+    match data.data_type() {
+        DataType::FixedSizeList(_, size) => {
+            let size = *size as usize;
+            nulls + child_slice_size(data, 0, data.offset() * size, data.len() * size)
+        }
+        // Like `StructArray`, treat children as sliced already when their length matches
+        DataType::Struct(_) => {
+            nulls
+                + data
+                    .child_data()
+                    .iter()
+                    .enumerate()
+                    .map(|(i, child)| {
+                        if child.len() == data.len() {
+                            slice_memory_size(child)
+                        } else {
+                            child_slice_size(data, i, data.offset(), data.len())
+                        }
+                    })
+                    .sum::<usize>()
+        }
+        DataType::List(_) => list_slice_size::<i32>(data, nulls),
+        DataType::LargeList(_) => list_slice_size::<i64>(data, nulls),
+        _ => data
+            .get_slice_memory_size()
+            .unwrap_or_else(|_| data.get_array_memory_size()),
+    }
+}
+
+fn list_slice_size<O: ArrowNativeType>(data: &ArrayData, nulls: usize) -> usize {
+    let Some(offsets) = data.buffer::<O>(0).get(..=data.len()) else {
+        return data.get_array_memory_size();
+    };
+    let start = offsets[0].as_usize();
+    let end = offsets[data.len()].as_usize();
+    nulls + std::mem::size_of_val(offsets) + child_slice_size(data, 0, start, end - start)
+}
+
+fn child_slice_size(data: &ArrayData, index: usize, offset: usize, len: usize) -> usize {
+    let child = &data.child_data()[index];
+    if offset + len > child.len() {
+        return child.get_array_memory_size();
+    }
+    slice_memory_size(&child.slice(offset, len))
+}
+
+/// Copy of `data` whose buffers keep `reservation` alive, without copying any values
+fn track_array(data: ArrayData, reservation: &Arc<Reservation>) -> ArrayData {
+    let buffers = data
+        .buffers()
+        .iter()
+        .map(|buffer| track_buffer(buffer, reservation))
+        .collect();
+    let child_data = data
+        .child_data()
+        .iter()
+        .map(|child| track_array(child.clone(), reservation))
+        .collect();
+    let nulls = data.nulls().map(|nulls| {
+        NullBuffer::new(BooleanBuffer::new(
+            track_buffer(nulls.buffer(), reservation),
+            nulls.offset(),
+            nulls.len(),
+        ))
+    });
+
+    let builder = data
+        .into_builder()
+        .buffers(buffers)
+        .child_data(child_data)
+        .nulls(nulls);
+    // The layout is unchanged, only the owners of the buffers are
+    unsafe { builder.build_unchecked() }
+}
+
+fn track_buffer(buffer: &Buffer, reservation: &Arc<Reservation>) -> Buffer {
+    let Some(ptr) = NonNull::new(buffer.as_ptr() as *mut u8) else {
+        return buffer.clone();
+    };
+    // The new buffer points into `buffer`, which the owner keeps alive
+    unsafe {
+        Buffer::from_custom_allocation(
+            ptr,
+            buffer.len(),
+            Arc::new((buffer.clone(), reservation.clone())),
+        )
+    }
+}
+
+/// Reader charging the batches it yields to a pool
+struct TrackedReader {
+    pool: Arc<MemoryPool>,
+    inner: Box<dyn RecordBatchReader + Send>,
+}
+
+impl Iterator for TrackedReader {
+    type Item = Result<RecordBatch, ArrowError>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        let batch = self.inner.next()?;
+        Some(batch.and_then(|batch| {
+            self.pool
+                .track_batch(batch)
+                .map_err(ArrowError::MemoryError)
+        }))
+    }
+}
+
+impl RecordBatchReader for TrackedReader {
+    fn schema(&self) -> SchemaRef {
+        self.inner.schema()
+    }
+}
@@ -0,0 +1,420 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The LanceDB Authors
+
+//! Process-wide metrics and tracing hooks for the FFI layer
+//!
+//! Every blocking entry point runs through `connection::block_on` and every asynchronous
+//! operation through its future, both of which time the operation and record it here under
+//! a static operation name. Record batches handed to the caller through the Arrow C ABI are
+//! counted as well. Operations are registered once in a static table of atomic counters,
+//! so recording a call takes no lock.
+
+use std::ffi::{CStr, CString};
+use std::fmt::Write;
+use std::os::raw::{c_char, c_int, c_void};
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::RwLock;
+use std::time::{Instant, SystemTime, UNIX_EPOCH};
+
+use arrow_array::RecordBatch;
+
+use crate::error::{set_invalid_argument_message, set_unknown_error_message, LanceDBError};
+
+/// Number of latency histogram buckets
+pub const LANCEDB_LATENCY_BUCKETS: usize = 24;
+
+/// Metrics of a single operation
+#[repr(C)]
+#[derive(Debug, Default, Copy, Clone)]
+pub struct LanceDBOperationMetrics {
+    pub calls: u64,                                      // Completed calls
+    pub errors: u64,                                     // Calls that returned an error
+    pub total_nanos: u64,                                // Sum of call latencies
+    pub max_nanos: u64,                                  // Latency of the slowest call
+    pub latency_buckets: [u64; LANCEDB_LATENCY_BUCKETS], // Bucket i counts calls under 2^i microseconds, the last bucket all slower calls
+}
+
+/// Metrics of data exported through the Arrow C ABI
+#[repr(C)]
+#[derive(Debug, Default, Copy, Clone)]
+pub struct LanceDBExportMetrics {
+    pub batches: u64, // Record batches exported
+    pub bytes: u64,   // Memory size of the exported batches
+}
+
+/// Finished operation passed to the span callback
+#[repr(C)]
+pub struct LanceDBSpan {
+    pub name: *const c_char,   // Operation name, e.g. "table_add"
+    pub start_unix_nanos: u64, // Start time in nanoseconds since the Unix epoch
+    pub duration_nanos: u64,   // Duration of the operation
+    pub error: c_int,          // 1 if the operation returned an error, 0 otherwise
+}
+
+/// Callback invoked for every finished operation
+pub type LanceDBSpanCallback =
+    Option<unsafe extern "C" fn(span: *const LanceDBSpan, user_data: *mut c_void)>;
+
+/// Registered span callback and its user data
+struct SpanHook {
+    callback: unsafe extern "C" fn(span: *const LanceDBSpan, user_data: *mut c_void),
+    user_data: *mut c_void,
+}
+
+// The user data pointer is only handed back to the caller's callback
+unsafe impl Send for SpanHook {}
+unsafe impl Sync for SpanHook {}
+
+/// Names of all measured operations, sorted for lookup by name
+///
+/// Every name passed to `Span::start` must be listed here; debug builds assert it.
+static OPERATION_NAMES: [&CStr; 55] = [
+    c"bulk_loader_commit",
+    c"connect_builder_execute",
+    c"connection_create_namespace",
+    c"connection_drop_all_tables",
+    c"connection_drop_namespace",
+    c"connection_drop_table",
+    c"connection_list_namespaces",
+    c"connection_open_table",
+    c"connection_rename_table",
+    c"connection_table_names",
+    c"maintenance_cleanup_old_versions",
+    c"maintenance_compact_files",
+    c"maintenance_optimize_indices",
+    c"query_analyze_plan",
+    c"query_execute",
+    c"query_execute_async",
+    c"query_explain_plan",
+    c"query_fragments",
+    c"query_result_next_batch",
+    c"query_result_next_batches",
+    c"query_result_stream_next",
+    c"query_result_to_arrow",
+    c"table_add",
+    c"table_add_async",
+    c"table_arrow_schema",
+    c"table_checkout",
+    c"table_cleanup_old_versions",
+    c"table_compact_files",
+    c"table_count_rows",
+    c"table_count_rows_approx",
+    c"table_count_rows_filtered",
+    c"table_create",
+    c"table_create_fts_index",
+    c"table_create_scalar_index",
+    c"table_create_vector_index",
+    c"table_delete",
+    c"table_drop_index",
+    c"table_index_stats",
+    c"table_list_fragments",
+    c"table_list_indices",
+    c"table_merge_insert",
+    c"table_merge_insert_async",
+    c"table_names_builder_execute",
+    c"table_nearest_to",
+    c"table_optimize",
+    c"table_prewarm_index",
+    c"table_snapshot",
+    c"table_take_row_ids",
+    c"table_update_index",
+    c"table_version",
+    c"vector_query_analyze_plan",
+    c"vector_query_coalesced",
+    c"vector_query_execute",
+    c"vector_query_execute_async",
+    c"vector_query_explain_plan",
+];
+
+/// Lock-free counters of an operation
+struct OperationCounters {
+    calls: AtomicU64,
+    errors: AtomicU64,
+    total_nanos: AtomicU64,
+    max_nanos: AtomicU64,
+    latency_buckets: [AtomicU64; LANCEDB_LATENCY_BUCKETS],
+}
+
+impl OperationCounters {
+    #[allow(clippy::declare_interior_mutable_const)]
+    const ZERO: Self = {
+        #[allow(clippy::declare_interior_mutable_const)]
+        const ZERO: AtomicU64 = AtomicU64::new(0);
+        Self {
+            calls: ZERO,
+            errors: ZERO,
+            total_nanos: ZERO,
+            max_nanos: ZERO,
+            latency_buckets: [ZERO; LANCEDB_LATENCY_BUCKETS],
+        }
+    };
+
+    fn record(&self, duration_nanos: u64, error: bool) {
+        self.calls.fetch_add(1, Ordering::Relaxed);
+        self.errors.fetch_add(error as u64, Ordering::Relaxed);
+        // Saturation is not worth a CAS loop, 2^64 ns are over 500 years of latency
+        self.total_nanos
+            .fetch_add(duration_nanos, Ordering::Relaxed);
+        self.max_nanos.fetch_max(duration_nanos, Ordering::Relaxed);
+        self.latency_buckets[bucket_index(duration_nanos)].fetch_add(1, Ordering::Relaxed);
+    }
+
+    fn snapshot(&self) -> LanceDBOperationMetrics {
+        let mut metrics = LanceDBOperationMetrics {
+            calls: self.calls.load(Ordering::Relaxed),
+            errors: self.errors.load(Ordering::Relaxed),
+            total_nanos: self.total_nanos.load(Ordering::Relaxed),
+            max_nanos: self.max_nanos.load(Ordering::Relaxed),
+            ..Default::default()
+        };
+        for (count, bucket) in metrics
+            .latency_buckets
+            .iter_mut()
+            .zip(&self.latency_buckets)
+        {
+            *count = bucket.load(Ordering::Relaxed);
+        }
+        metrics
+    }
+
+    fn reset(&self) {
+        for counter in [
+            &self.calls,
+            &self.errors,
+            &self.total_nanos,
+            &self.max_nanos,
+        ]
+        .into_iter()
+        .chain(&self.latency_buckets)
+        {
+            counter.store(0, Ordering::Relaxed);
+        }
+    }
+}
+
+static OPERATIONS: [OperationCounters; OPERATION_NAMES.len()] =
+    [OperationCounters::ZERO; OPERATION_NAMES.len()];
+static SPAN_HOOK: RwLock<Option<SpanHook>> = RwLock::new(None);
+static EXPORTED_BATCHES: AtomicU64 = AtomicU64::new(0);
+static EXPORTED_BYTES: AtomicU64 = AtomicU64::new(0);
+
+/// Outcome of a measured operation
+pub(crate) trait Outcome {
+    fn is_error(&self) -> bool;
+}
+
+impl<T, E> Outcome for Result<T, E> {
+    fn is_error(&self) -> bool {
+        self.is_err()
+    }
+}
+
+impl<T, E> Outcome for Option<Result<T, E>> {
+    fn is_error(&self) -> bool {
+        matches!(self, Some(Err(_)))
+    }
+}
+
+/// Counters of the operation called `name`, if it is registered
+fn operation_counters(name: &CStr) -> Option<&'static OperationCounters> {
+    OPERATION_NAMES
+        .binary_search(&name)
+        .ok()
+        .map(|index| &OPERATIONS[index])
+}
+
+/// Running operation, recorded when finished
+pub(crate) struct Span {
+    name: &'static CStr,
+    counters: Option<&'static OperationCounters>,
+    start: Instant,
+    start_time: SystemTime,
+}
+
+impl Span {
+    pub(crate) fn start(name: &'static CStr) -> Self {
+        let counters = operation_counters(name);
+        debug_assert!(counters.is_some(), "operation {name:?} is not registered");
+        Self {
+            name,
+            counters,
+            start: Instant::now(),
+            start_time: SystemTime::now(),
+        }
+    }
+
+    pub(crate) fn finish(self, error: bool) {
+        let duration_nanos = saturating_nanos(self.start.elapsed().as_nanos());
+        if let Some(counters) = self.counters {
+            counters.record(duration_nanos, error);
+        }
+
+        // Call outside the lock, so the callback may replace itself without deadlocking
+        let hook = SPAN_HOOK
+            .read()
+            .unwrap()
+            .as_ref()
+            .map(|hook| (hook.callback, hook.user_data));
+        if let Some((callback, user_data)) = hook {
+            let start_unix_nanos = self
+                .start_time
+                .duration_since(UNIX_EPOCH)
+                .map(|since_epoch| saturating_nanos(since_epoch.as_nanos()))
+                .unwrap_or(0);
+            let span = LanceDBSpan {
+                name: self.name.as_ptr(),
+                start_unix_nanos,
+                duration_nanos,
+                error: error as c_int,
+            };
+            unsafe { callback(&span, user_data) };
+        }
+    }
+}
+
+/// Record a batch exported to the caller
+pub(crate) fn record_export(batch: &RecordBatch) {
+    EXPORTED_BATCHES.fetch_add(1, Ordering::Relaxed);
+    EXPORTED_BYTES.fetch_add(batch.get_array_memory_size() as u64, Ordering::Relaxed);
+}
+
+fn saturating_nanos(nanos: u128) -> u64 {
+    nanos.min(u64::MAX as u128) as u64
+}
+
+/// Index of the smallest bucket `i` with `duration < 2^i` microseconds
+fn bucket_index(duration_nanos: u64) -> usize {
+    let micros = duration_nanos / 1000;
+    ((u64::BITS - micros.leading_zeros()) as usize).min(LANCEDB_LATENCY_BUCKETS - 1)
+}
+
+/// Get the metrics of an operation
+///
+/// # Safety
+/// - `name` must be a valid null-terminated C string
+/// - `metrics_out` must be a valid pointer to receive the metrics
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - Operations that never ran report zeroed metrics
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_metrics_operation(
+    name: *const c_char,
+    metrics_out: *mut LanceDBOperationMetrics,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if name.is_null() || metrics_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    *metrics_out = operation_counters(CStr::from_ptr(name))
+        .map(OperationCounters::snapshot)
+        .unwrap_or_default();
+    LanceDBError::Success
+}
+
+/// Get the metrics of data exported through the Arrow C ABI
+///
+/// # Safety
+/// - `metrics_out` must be a valid pointer to receive the metrics
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_metrics_exported(metrics_out: *mut LanceDBExportMetrics) {
+    if metrics_out.is_null() {
+        return;
+    }
+
+    *metrics_out = LanceDBExportMetrics {
+        batches: EXPORTED_BATCHES.load(Ordering::Relaxed),
+        bytes: EXPORTED_BYTES.load(Ordering::Relaxed),
+    };
+}
+
+/// Get all metrics as a JSON document
+///
+/// # Safety
+/// - `report_out` must be a valid pointer to receive the JSON string
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - The report must be freed with `lancedb_free_string`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_metrics_report(
+    report_out: *mut *mut c_char,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if report_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    // Operation names are static identifiers, so they need no escaping
+    let mut report = String::from("{\"operations\":{");
+    let ran = OPERATION_NAMES
+        .iter()
+        .zip(&OPERATIONS)
+        .map(|(name, counters)| (name, counters.snapshot()))
+        .filter(|(_, metrics)| metrics.calls > 0);
+    for (i, (name, metrics)) in ran.enumerate() {
+        let buckets = metrics
+            .latency_buckets
+            .iter()
+            .map(|count| count.to_string())
+            .collect::<Vec<_>>()
+            .join(",");
+        let _ = write!(
+            report,
+            "{}\"{}\":{{\"calls\":{},\"errors\":{},\"total_nanos\":{},\"max_nanos\":{},\"latency_buckets\":[{}]}}",
+            if i > 0 { "," } else { "" },
+            name.to_string_lossy(),
+            metrics.calls,
+            metrics.errors,
+            metrics.total_nanos,
+            metrics.max_nanos,
+            buckets
+        );
+    }
+    let _ = write!(
+        report,
+        "}},\"exported\":{{\"batches\":{},\"bytes\":{}}}}}",
+        EXPORTED_BATCHES.load(Ordering::Relaxed),
+        EXPORTED_BYTES.load(Ordering::Relaxed)
+    );
+
+    match CString::new(report) {
+        Ok(report) => {
+            *report_out = report.into_raw();
+            LanceDBError::Success
+        }
+        Err(_) => {
+            set_unknown_error_message(error_message);
+            LanceDBError::Unknown
+        }
+    }
+}
+
+/// Reset all metrics to zero
+#[no_mangle]
+pub extern "C" fn lancedb_metrics_reset() {
+    OPERATIONS.iter().for_each(OperationCounters::reset);
+    EXPORTED_BATCHES.store(0, Ordering::Relaxed);
+    EXPORTED_BYTES.store(0, Ordering::Relaxed);
+}
+
+/// Register the callback invoked for every finished operation
+///
+/// # Safety
+/// - `callback` can be NULL to remove the current callback; otherwise it must be safe to
+///   call from any thread with `user_data`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_metrics_set_span_callback(
+    callback: LanceDBSpanCallback,
+    user_data: *mut c_void,
+) {
+    *SPAN_HOOK.write().unwrap() = callback.map(|callback| SpanHook {
+        callback,
+        user_data,
+    });
+}
@@ -5,38 +5,57 @@
 //!
 //! This module provides complete query operations with proper Arrow integration
 
-use std::ffi::CStr;
-use std::os::raw::{c_char, c_float};
+use std::ffi::{CStr, CString};
+use std::os::raw::{c_char, c_float, c_int, c_void};
 use std::ptr;
 use std::sync::Arc;
 
 use arrow_array::ffi::FFI_ArrowArray;
-use arrow_array::{Array, RecordBatch, StructArray};
+use arrow_array::ffi_stream::FFI_ArrowArrayStream;
+use arrow_array::{Array, ArrayRef, RecordBatch, RecordBatchReader, StructArray};
 use arrow_data::ArrayData;
-use futures::TryStreamExt;
+use arrow_schema::{ArrowError, DataType, SchemaRef};
+use futures::{StreamExt, TryStreamExt};
 
-use lancedb::query::{ExecutableQuery, QueryBase, Select};
+use lancedb::arrow::SendableRecordBatchStream;
+use lancedb::index::scalar::FullTextSearchQuery;
+use lancedb::query::{ExecutableQuery, Query, QueryBase, Select, VectorQuery};
 use lancedb::{DistanceType, Table};
 
-use crate::connection::{get_runtime, LanceDBTable};
-use crate::error::{set_invalid_argument_message, set_unknown_error_message, LanceDBError};
-use crate::types::LanceDBDistanceType;
+use crate::coalesce::QueryCoalescer;
+use crate::connection::{block_on, LanceDBTable, SnapshotCache};
+use crate::error::{
+    handle_error, set_invalid_argument_message, set_unknown_error_message, LanceDBError,
+};
+use crate::fragment::{execute_scanner, DatasetOptions, FragmentScan};
+use crate::memory::MemoryPool;
+use crate::metrics::record_export;
+use crate::rerank::LanceDBRerankerConfig;
+use crate::table::export_batches;
+use crate::types::{query_vectors_from_raw, LanceDBDistanceType, LanceDBVectorElementType};
 
 /// Opaque handle to a LanceDB Query
 #[repr(C)]
+#[derive(Clone)]
 pub struct LanceDBQuery {
     table: Arc<Table>,
     limit: Option<usize>,
     offset: Option<usize>,
     select: Option<Select>,
     filter: Option<String>,
+    full_text_search: Option<FullTextSearch>,
+    dataset_options: Arc<DatasetOptions>,
+    fragments: Option<FragmentScan>,
+    with_row_id: bool,
+    memory: Arc<MemoryPool>,
 }
 
 /// Opaque handle to a LanceDB VectorQuery
 #[repr(C)]
+#[derive(Clone)]
 pub struct LanceDBVectorQuery {
     table: Arc<Table>,
-    query_vector: Vec<f32>,
+    query_vectors: Vec<ArrayRef>,
     column: Option<String>,
     limit: Option<usize>,
     offset: Option<usize>,
@@ -46,13 +65,72 @@ pub struct LanceDBVectorQuery {
     nprobes: Option<usize>,
     refine_factor: Option<u32>,
     ef: Option<usize>,
+    full_text_search: Option<FullTextSearch>,
+    reranker: Option<LanceDBRerankerConfig>,
+    postfilter: bool,
+    fast_search: bool,
+    bypass_vector_index: bool,
+    with_row_id: bool,
+    coalescer: Option<Arc<QueryCoalescer>>,
+    // Snapshot of the table handle, to build coalescing keys without a round trip
+    snapshot: Arc<SnapshotCache>,
+    memory: Arc<MemoryPool>,
+}
+
+/// Full-text search terms and the columns to search
+#[derive(Clone)]
+struct FullTextSearch {
+    query: String,
+    columns: Vec<String>,
+}
+
+impl FullTextSearch {
+    fn into_query(self) -> lancedb::error::Result<FullTextSearchQuery> {
+        let query = FullTextSearchQuery::new(self.query);
+        if self.columns.is_empty() {
+            Ok(query)
+        } else {
+            Ok(query.with_columns(&self.columns)?)
+        }
+    }
 }
 
 /// Query result handle for streaming results
 #[repr(C)]
 pub struct LanceDBQueryResult {
-    inner:
-        Box<dyn futures::Stream<Item = Result<RecordBatch, lancedb::error::Error>> + Send + Unpin>,
+    inner: SendableRecordBatchStream,
+}
+
+/// RecordBatchReader that pulls batches from a query result stream on demand
+///
+/// Used to export a query result through the Arrow C stream interface. Each call to
+/// `next` drives the underlying async stream on the shared runtime for exactly one batch.
+struct QueryResultReader {
+    schema: SchemaRef,
+    stream: SendableRecordBatchStream,
+}
+
+impl Iterator for QueryResultReader {
+    type Item = Result<RecordBatch, ArrowError>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        block_on(c"query_result_stream_next", self.stream.next())
+            .map(|batch| batch.map_err(|e| ArrowError::ExternalError(Box::new(e))))
+    }
+}
+
+impl RecordBatchReader for QueryResultReader {
+    fn schema(&self) -> SchemaRef {
+        self.schema.clone()
+    }
+}
+
+/// Convert a RecordBatch to an Arrow C ABI array, moving its buffers without a copy
+pub(crate) fn batch_to_ffi_array(batch: RecordBatch) -> FFI_ArrowArray {
+    record_export(&batch);
+    let struct_array: StructArray = batch.into();
+    let array_data: ArrayData = struct_array.into_data();
+    FFI_ArrowArray::new(&array_data)
 }
 
 /// Create a new query for the given table
@@ -76,6 +154,11 @@ pub unsafe extern "C" fn lancedb_query_new(table: *const LanceDBTable) -> *mut L
         offset: None,
         select: None,
         filter: None,
+        full_text_search: None,
+        dataset_options: (*table).dataset_options.clone(),
+        fragments: None,
+        with_row_id: false,
+        memory: (*table).memory.clone(),
     });
 
     Box::into_raw(query)
@@ -97,17 +180,74 @@ pub unsafe extern "C" fn lancedb_vector_query_new(
     vector: *const c_float,
     dimension: usize,
 ) -> *mut LanceDBVectorQuery {
-    if table.is_null() || vector.is_null() || dimension == 0 {
+    lancedb_vector_query_new_batch(table, vector, 1, dimension)
+}
+
+/// Create a vector query from table with multiple query vectors
+///
+/// All query vectors are searched by a single query. When more than one vector is
+/// given, the results carry a `query_index` column with the row index of the query
+/// vector each result belongs to, and limit/offset apply to each query vector.
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `vectors` must be a valid pointer to a row-major matrix of `num_queries` x `dimension` floats
+/// - `dimension` must match the actual dimension of the vector column
+///
+/// # Returns
+/// - Non-null pointer to LanceDBVectorQuery on success
+/// - Null pointer on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_new_batch(
+    table: *const LanceDBTable,
+    vectors: *const c_float,
+    num_queries: usize,
+    dimension: usize,
+) -> *mut LanceDBVectorQuery {
+    lancedb_vector_query_new_typed(
+        table,
+        vectors as *const c_void,
+        LanceDBVectorElementType::Float32,
+        num_queries,
+        dimension,
+    )
+}
+
+/// Create a vector query from table with query vectors of the given element type
+///
+/// Float16 vectors are IEEE 754 half precision bit patterns. UInt8 vectors are
+/// bit-packed binary vectors for Hamming distance, with `dimension` counted in bytes.
+/// Query vectors of a different floating point type than the vector column are cast
+/// to the column type.
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `vectors` must be a valid pointer to a row-major matrix of `num_queries` x `dimension`
+///   elements of `element_type`; it is copied and can be released after the call
+/// - `dimension` must match the actual dimension of the vector column
+///
+/// # Returns
+/// - Non-null pointer to LanceDBVectorQuery on success
+/// - Null pointer on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_new_typed(
+    table: *const LanceDBTable,
+    vectors: *const c_void,
+    element_type: LanceDBVectorElementType,
+    num_queries: usize,
+    dimension: usize,
+) -> *mut LanceDBVectorQuery {
+    if table.is_null() || vectors.is_null() || num_queries == 0 || dimension == 0 {
         return ptr::null_mut();
     }
 
     let tbl = &(*table).inner;
-    let vec_slice = std::slice::from_raw_parts(vector, dimension);
-    let vec_data: Vec<f32> = vec_slice.to_vec();
+    let query_vectors = query_vectors_from_raw(vectors, element_type, num_queries, dimension);
+    let coalescer = (*table).coalescer.clone();
 
     let vector_query = Box::new(LanceDBVectorQuery {
         table: Arc::new(tbl.clone()),
-        query_vector: vec_data,
+        query_vectors,
         column: None,
         limit: None,
         offset: None,
@@ -117,11 +257,47 @@ pub unsafe extern "C" fn lancedb_vector_query_new(
         nprobes: None,
         refine_factor: None,
         ef: None,
+        full_text_search: None,
+        reranker: None,
+        postfilter: false,
+        fast_search: false,
+        bypass_vector_index: false,
+        with_row_id: false,
+        coalescer,
+        snapshot: (*table).snapshot.clone(),
+        memory: (*table).memory.clone(),
     });
 
     Box::into_raw(vector_query)
 }
 
+/// Create a multivector query from table with the vectors of one query
+///
+/// Searches a multivector column (a list of fixed size vectors per row, e.g.
+/// late-interaction token embeddings) with all given vectors as a single query. Rows are
+/// scored by max-sim: for each query vector the best matching vector of the row, summed
+/// over the query vectors. The results carry no `query_index` column.
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `vectors` must be a valid pointer to a row-major matrix of `num_vectors` x `dimension` floats
+/// - `dimension` must match the dimension of the vectors in the multivector column
+///
+/// # Returns
+/// - Non-null pointer to LanceDBVectorQuery on success
+/// - Null pointer on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_new_multivector(
+    table: *const LanceDBTable,
+    vectors: *const c_float,
+    num_vectors: usize,
+    dimension: usize,
+) -> *mut LanceDBVectorQuery {
+    // lancedb combines several query vectors against a multivector column into one
+    // multivector query instead of a batch of independent queries
+    lancedb_vector_query_new_batch(table, vectors, num_vectors, dimension)
+}
+
 /// Set limit for query
 ///
 /// # Safety
@@ -236,6 +412,123 @@ pub unsafe extern "C" fn lancedb_query_where_filter(
     LanceDBError::Success
 }
 
+/// Read full-text search terms and optional column names from C
+unsafe fn full_text_search_from_c(
+    text: *const c_char,
+    columns: *const *const c_char,
+    num_columns: usize,
+) -> Option<FullTextSearch> {
+    if text.is_null() || (columns.is_null() && num_columns > 0) {
+        return None;
+    }
+
+    let query = CStr::from_ptr(text).to_str().ok()?.to_string();
+    let mut column_names = Vec::with_capacity(num_columns);
+    for i in 0..num_columns {
+        let col_ptr = *columns.add(i);
+        if col_ptr.is_null() {
+            return None;
+        }
+        column_names.push(CStr::from_ptr(col_ptr).to_str().ok()?.to_string());
+    }
+
+    Some(FullTextSearch {
+        query,
+        columns: column_names,
+    })
+}
+
+/// Turn query into a full-text search
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_query_new`
+/// - `text` must be a valid null-terminated C string containing the search terms
+/// - `columns` can be NULL (with `num_columns` 0) to search all FTS indexed columns,
+///   otherwise an array of valid null-terminated C strings
+/// - `error_message` can be NULL to ignore detailed error messages
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_query_full_text_search(
+    query: *mut LanceDBQuery,
+    text: *const c_char,
+    columns: *const *const c_char,
+    num_columns: usize,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let Some(full_text_search) = full_text_search_from_c(text, columns, num_columns) else {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    };
+
+    (*query).full_text_search = Some(full_text_search);
+    LanceDBError::Success
+}
+
+/// Include the `_rowid` column in query results
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_query_new`
+/// - `error_message` can be NULL to ignore detailed error messages
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_query_with_row_id(
+    query: *mut LanceDBQuery,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    (*query).with_row_id = true;
+    LanceDBError::Success
+}
+
+/// Restrict query to fragments of a table version
+///
+/// Queries over disjoint fragment sets of the same version read disjoint rows, and
+/// together with all fragments from `lancedb_table_list_fragments` they cover the table.
+/// Limit and offset apply to the selected fragments.
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_query_new`
+/// - `fragment_ids` must be a valid pointer to `num_fragments` fragment IDs
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - `InvalidInput` if a fragment does not exist in `version`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_query_fragments(
+    query: *mut LanceDBQuery,
+    fragment_ids: *const u64,
+    num_fragments: usize,
+    version: u64,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() || fragment_ids.is_null() || num_fragments == 0 {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let fragment_ids = std::slice::from_raw_parts(fragment_ids, num_fragments);
+    let query = &mut *query;
+
+    match block_on(
+        c"query_fragments",
+        FragmentScan::new(&query.table, &query.dataset_options, version, fragment_ids),
+    ) {
+        Ok(fragments) => {
+            query.fragments = Some(fragments);
+            LanceDBError::Success
+        }
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
 /// Set limit for vector query
 ///
 /// # Safety
@@ -463,6 +756,518 @@ pub unsafe extern "C" fn lancedb_vector_query_ef(
     LanceDBError::Success
 }
 
+/// Build and execute a query on the shared runtime
+pub(crate) async fn execute_query(
+    query: LanceDBQuery,
+) -> lancedb::error::Result<SendableRecordBatchStream> {
+    let memory = query.memory.clone();
+    let stream = if query.fragments.is_some() {
+        execute_scanner(fragment_scanner(&query)?).await?
+    } else {
+        build_query(query)?.execute().await?
+    };
+    Ok(memory.track_stream(stream))
+}
+
+/// Build the Lance scanner of a query restricted to fragments
+fn fragment_scanner(
+    query: &LanceDBQuery,
+) -> lancedb::error::Result<lance::dataset::scanner::Scanner> {
+    let Some(ref fragments) = query.fragments else {
+        return Err(lancedb::error::Error::InvalidInput {
+            message: "query is not restricted to fragments".to_string(),
+        });
+    };
+    if query.full_text_search.is_some() {
+        return Err(lancedb::error::Error::NotSupported {
+            message: "full-text search cannot be restricted to fragments".to_string(),
+        });
+    }
+    let mut scanner = fragments.scanner(
+        query.limit,
+        query.offset,
+        query.select.as_ref(),
+        query.filter.as_deref(),
+    )?;
+    if query.with_row_id {
+        scanner.with_row_id();
+    }
+    Ok(scanner)
+}
+
+/// Build the lancedb query described by a query handle
+fn build_query(query: LanceDBQuery) -> lancedb::error::Result<Query> {
+    let mut rust_query = query.table.query();
+
+    if let Some(limit) = query.limit {
+        rust_query = rust_query.limit(limit);
+    }
+    if let Some(offset) = query.offset {
+        rust_query = rust_query.offset(offset);
+    }
+    if let Some(select) = query.select {
+        rust_query = rust_query.select(select);
+    }
+    if let Some(ref filter) = query.filter {
+        rust_query = rust_query.only_if(filter);
+    }
+    if let Some(full_text_search) = query.full_text_search {
+        rust_query = rust_query.full_text_search(full_text_search.into_query()?);
+    }
+    if query.with_row_id {
+        rust_query = rust_query.with_row_id();
+    }
+
+    Ok(rust_query)
+}
+
+/// Apply the WHERE filter of vector query after the vector search
+///
+/// By default the filter is applied before the search (prefilter), which always
+/// returns `limit` matching rows. A postfilter can return fewer rows, but avoids
+/// evaluating the filter on the whole table.
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_vector_query_new`
+/// - `error_message` can be NULL to ignore detailed error messages
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_postfilter(
+    query: *mut LanceDBVectorQuery,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    (*query).postfilter = true;
+    LanceDBError::Success
+}
+
+/// Search only indexed data, skipping rows added since the index was last updated
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_vector_query_new`
+/// - `error_message` can be NULL to ignore detailed error messages
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_fast_search(
+    query: *mut LanceDBVectorQuery,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    (*query).fast_search = true;
+    LanceDBError::Success
+}
+
+/// Perform an exact (flat) search instead of using the vector index
+///
+/// Combined with a selective prefilter this only computes distances for the
+/// matching rows, which is faster than an index search for small subsets.
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_vector_query_new`
+/// - `error_message` can be NULL to ignore detailed error messages
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_bypass_vector_index(
+    query: *mut LanceDBVectorQuery,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    (*query).bypass_vector_index = true;
+    LanceDBError::Success
+}
+
+/// Include the `_rowid` column in vector query results
+///
+/// Row IDs can be passed to `lancedb_table_take_row_ids` to fetch further columns of
+/// the results, so the search itself only needs to project `_rowid` and `_distance`.
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_vector_query_new`
+/// - `error_message` can be NULL to ignore detailed error messages
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_with_row_id(
+    query: *mut LanceDBVectorQuery,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    (*query).with_row_id = true;
+    LanceDBError::Success
+}
+
+/// Add a full-text search to vector query, making it a hybrid query
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_vector_query_new`
+/// - `text` must be a valid null-terminated C string containing the search terms
+/// - `columns` can be NULL (with `num_columns` 0) to search all FTS indexed columns,
+///   otherwise an array of valid null-terminated C strings
+/// - `error_message` can be NULL to ignore detailed error messages
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_full_text_search(
+    query: *mut LanceDBVectorQuery,
+    text: *const c_char,
+    columns: *const *const c_char,
+    num_columns: usize,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let Some(full_text_search) = full_text_search_from_c(text, columns, num_columns) else {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    };
+
+    (*query).full_text_search = Some(full_text_search);
+    LanceDBError::Success
+}
+
+/// Set reranker combining the results of a hybrid query
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_vector_query_new`
+/// - `config` can be NULL for default RRF reranking
+/// - `error_message` can be NULL to ignore detailed error messages
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_rerank(
+    query: *mut LanceDBVectorQuery,
+    config: *const LanceDBRerankerConfig,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    (*query).reranker = Some(if config.is_null() {
+        LanceDBRerankerConfig::default()
+    } else {
+        *config
+    });
+    LanceDBError::Success
+}
+
+/// Turn a plain query into a vector query searching all given query vectors
+pub(crate) fn nearest_to_all(
+    query: Query,
+    query_vectors: Vec<ArrayRef>,
+) -> lancedb::error::Result<VectorQuery> {
+    let mut query_vectors = query_vectors.into_iter();
+    let first = query_vectors
+        .next()
+        .ok_or_else(|| lancedb::error::Error::InvalidInput {
+            message: "vector query has no query vectors".to_string(),
+        })?;
+
+    let mut vector_query = query.nearest_to(first)?;
+    for query_vector in query_vectors {
+        vector_query = vector_query.add_query_vector(query_vector)?;
+    }
+    Ok(vector_query)
+}
+
+/// Build and execute a vector query on the shared runtime
+pub(crate) async fn execute_vector_query(
+    query: LanceDBVectorQuery,
+) -> lancedb::error::Result<SendableRecordBatchStream> {
+    let memory = query.memory.clone();
+    let stream = match query.coalescer.clone() {
+        Some(coalescer) => match query.coalesce_key().await? {
+            Some(key) => coalescer.execute(key, query).await?,
+            None => build_vector_query(query)?.execute().await?,
+        },
+        None => build_vector_query(query)?.execute().await?,
+    };
+    Ok(memory.track_stream(stream))
+}
+
+impl LanceDBVectorQuery {
+    /// Key shared by the queries that can run together as one multi-vector query,
+    /// None if the query cannot be coalesced
+    async fn coalesce_key(&self) -> lancedb::error::Result<Option<String>> {
+        if self.coalescer.is_none()
+            || self.query_vectors.len() != 1
+            || self.full_text_search.is_some()
+            || self.reranker.is_some()
+        {
+            return Ok(None);
+        }
+
+        // Served from the handle's snapshot within the read consistency interval
+        let snapshot = self
+            .snapshot
+            .current(&self.table, self.snapshot.max_age)
+            .await?;
+
+        // Single-vector queries against a multivector column would merge into one
+        // multivector query, so only plain vector columns are coalesced
+        let column = match &self.column {
+            Some(column) => match snapshot.schema.field_with_name(column) {
+                Ok(field) if matches!(field.data_type(), DataType::FixedSizeList(..)) => column,
+                _ => return Ok(None),
+            },
+            None => match &snapshot.default_vector_column {
+                Some(column) => column,
+                None => return Ok(None),
+            },
+        };
+
+        // Tables of the same name in different namespaces or databases must not merge
+        let table_id = match self.table.as_native() {
+            Some(native) => native.dataset_uri().to_string(),
+            None => format!("{:p}", Arc::as_ptr(&self.snapshot)),
+        };
+
+        Ok(Some(format!(
+            "{}@{}|{}|{:?}|{:?}|{:?}|{:?}|{:?}|{:?}|{:?}|{:?}|{:?}|{}|{}|{}|{}",
+            table_id,
+            snapshot.version,
+            column,
+            self.query_vectors[0].data_type(),
+            self.limit,
+            self.offset,
+            self.select,
+            self.filter,
+            self.distance_type,
+            self.nprobes,
+            self.refine_factor,
+            self.ef,
+            self.postfilter,
+            self.fast_search,
+            self.bypass_vector_index,
+            self.with_row_id
+        )))
+    }
+
+    pub(crate) fn first_query_vector(&self) -> ArrayRef {
+        self.query_vectors[0].clone()
+    }
+
+    /// Same query searching the given vectors
+    pub(crate) fn with_query_vectors(self, query_vectors: Vec<ArrayRef>) -> Self {
+        Self {
+            query_vectors,
+            ..self
+        }
+    }
+}
+
+/// Build the lancedb vector query described by a vector query handle
+pub(crate) fn build_vector_query(query: LanceDBVectorQuery) -> lancedb::error::Result<VectorQuery> {
+    let mut rust_query = nearest_to_all(query.table.query(), query.query_vectors)?;
+
+    if let Some(ref column) = query.column {
+        rust_query = rust_query.column(column);
+    }
+    if let Some(limit) = query.limit {
+        rust_query = rust_query.limit(limit);
+    }
+    if let Some(offset) = query.offset {
+        rust_query = rust_query.offset(offset);
+    }
+    if let Some(select) = query.select {
+        rust_query = rust_query.select(select);
+    }
+    if let Some(ref filter) = query.filter {
+        rust_query = rust_query.only_if(filter);
+    }
+    if let Some(distance_type) = query.distance_type {
+        rust_query = rust_query.distance_type(distance_type);
+    }
+    if let Some(nprobes) = query.nprobes {
+        rust_query = rust_query.nprobes(nprobes);
+    }
+    if let Some(refine_factor) = query.refine_factor {
+        rust_query = rust_query.refine_factor(refine_factor);
+    }
+    if let Some(ef) = query.ef {
+        rust_query = rust_query.ef(ef);
+    }
+    if query.postfilter {
+        rust_query = rust_query.postfilter();
+    }
+    if query.fast_search {
+        rust_query = rust_query.fast_search();
+    }
+    if query.bypass_vector_index {
+        rust_query = rust_query.bypass_vector_index();
+    }
+    if query.with_row_id {
+        rust_query = rust_query.with_row_id();
+    }
+    if let Some(full_text_search) = query.full_text_search {
+        rust_query = rust_query.full_text_search(full_text_search.into_query()?);
+    }
+    if let Some(reranker) = query.reranker {
+        rust_query = rust_query
+            .rerank(reranker.reranker())
+            .norm(reranker.normalize.into());
+    }
+
+    Ok(rust_query)
+}
+
+/// Hand a query plan to the caller as a C string
+unsafe fn set_plan_output(
+    plan: lancedb::error::Result<String>,
+    plan_out: *mut *mut c_char,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    match plan {
+        Ok(plan) => match CString::new(plan) {
+            Ok(c_str) => {
+                *plan_out = c_str.into_raw();
+                LanceDBError::Success
+            }
+            Err(_) => {
+                set_unknown_error_message(error_message);
+                LanceDBError::Unknown
+            }
+        },
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
+/// Get the execution plan of query without running it
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_query_new`; it is not consumed
+/// - `plan_out` must be a valid pointer to receive the plan string
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - Caller must free the plan with `lancedb_free_string`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_query_explain_plan(
+    query: *const LanceDBQuery,
+    verbose: c_int,
+    plan_out: *mut *mut c_char,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() || plan_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let query = (*query).clone();
+    let plan = block_on(c"query_explain_plan", async move {
+        if query.fragments.is_some() {
+            return Ok(fragment_scanner(&query)?.explain_plan(verbose != 0).await?);
+        }
+        build_query(query)?.explain_plan(verbose != 0).await
+    });
+    set_plan_output(plan, plan_out, error_message)
+}
+
+/// Run query and get its execution plan annotated with runtime metrics
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_query_new`; it is not consumed
+/// - `plan_out` must be a valid pointer to receive the plan string
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - Caller must free the plan with `lancedb_free_string`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_query_analyze_plan(
+    query: *const LanceDBQuery,
+    plan_out: *mut *mut c_char,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() || plan_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let query = (*query).clone();
+    let plan = block_on(c"query_analyze_plan", async move {
+        if query.fragments.is_some() {
+            return Ok(fragment_scanner(&query)?.analyze_plan().await?);
+        }
+        build_query(query)?.analyze_plan().await
+    });
+    set_plan_output(plan, plan_out, error_message)
+}
+
+/// Get the execution plan of vector query without running it
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_vector_query_new`; it is not consumed
+/// - `plan_out` must be a valid pointer to receive the plan string
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - Caller must free the plan with `lancedb_free_string`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_explain_plan(
+    query: *const LanceDBVectorQuery,
+    verbose: c_int,
+    plan_out: *mut *mut c_char,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() || plan_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let query = (*query).clone();
+    let plan = block_on(c"vector_query_explain_plan", async move {
+        build_vector_query(query)?.explain_plan(verbose != 0).await
+    });
+    set_plan_output(plan, plan_out, error_message)
+}
+
+/// Run vector query and get its execution plan annotated with runtime metrics
+///
+/// # Safety
+/// - `query` must be a valid pointer returned from `lancedb_vector_query_new`; it is not consumed
+/// - `plan_out` must be a valid pointer to receive the plan string
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - Caller must free the plan with `lancedb_free_string`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_vector_query_analyze_plan(
+    query: *const LanceDBVectorQuery,
+    plan_out: *mut *mut c_char,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if query.is_null() || plan_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let query = (*query).clone();
+    let plan = block_on(c"vector_query_analyze_plan", async move {
+        build_vector_query(query)?.analyze_plan().await
+    });
+    set_plan_output(plan, plan_out, error_message)
+}
+
+/// Wrap a result stream into a query result handle
+pub(crate) fn new_query_result(stream: SendableRecordBatchStream) -> *mut LanceDBQueryResult {
+    Box::into_raw(Box::new(LanceDBQueryResult { inner: stream }))
+}
+
 /// Execute query and return streaming result
 ///
 /// # Safety
@@ -477,32 +1282,9 @@ pub unsafe extern "C" fn lancedb_query_execute(
     }
 
     let query_box = Box::from_raw(query);
-    let runtime = get_runtime();
-
-    match runtime.block_on(async {
-        let mut rust_query = query_box.table.query();
-
-        if let Some(limit) = query_box.limit {
-            rust_query = rust_query.limit(limit);
-        }
-        if let Some(offset) = query_box.offset {
-            rust_query = rust_query.offset(offset);
-        }
-        if let Some(ref select) = query_box.select {
-            rust_query = rust_query.select(select.clone());
-        }
-        if let Some(ref filter) = query_box.filter {
-            rust_query = rust_query.only_if(filter);
-        }
 
-        rust_query.execute().await
-    }) {
-        Ok(stream) => {
-            let result = Box::new(LanceDBQueryResult {
-                inner: Box::new(stream),
-            });
-            Box::into_raw(result)
-        }
+    match block_on(c"query_execute", execute_query(*query_box)) {
+        Ok(stream) => new_query_result(stream),
         Err(_) => ptr::null_mut(),
     }
 }
@@ -521,54 +1303,9 @@ pub unsafe extern "C" fn lancedb_vector_query_execute(
     }
 
     let query_box = Box::from_raw(query);
-    let runtime = get_runtime();
-
-    match runtime.block_on(async {
-        let mut rust_query = match query_box
-            .table
-            .query()
-            .nearest_to(query_box.query_vector.clone())
-        {
-            Ok(q) => q,
-            Err(e) => return Err(e),
-        };
-
-        if let Some(ref column) = query_box.column {
-            rust_query = rust_query.column(column);
-        }
-        if let Some(limit) = query_box.limit {
-            rust_query = rust_query.limit(limit);
-        }
-        if let Some(offset) = query_box.offset {
-            rust_query = rust_query.offset(offset);
-        }
-        if let Some(ref select) = query_box.select {
-            rust_query = rust_query.select(select.clone());
-        }
-        if let Some(ref filter) = query_box.filter {
-            rust_query = rust_query.only_if(filter);
-        }
-        if let Some(distance_type) = query_box.distance_type {
-            rust_query = rust_query.distance_type(distance_type);
-        }
-        if let Some(nprobes) = query_box.nprobes {
-            rust_query = rust_query.nprobes(nprobes);
-        }
-        if let Some(refine_factor) = query_box.refine_factor {
-            rust_query = rust_query.refine_factor(refine_factor);
-        }
-        if let Some(ef) = query_box.ef {
-            rust_query = rust_query.ef(ef);
-        }
 
-        rust_query.execute().await
-    }) {
-        Ok(stream) => {
-            let result = Box::new(LanceDBQueryResult {
-                inner: Box::new(stream),
-            });
-            Box::into_raw(result)
-        }
+    match block_on(c"vector_query_execute", execute_vector_query(*query_box)) {
+        Ok(stream) => new_query_result(stream),
         Err(_) => ptr::null_mut(),
     }
 }
@@ -595,59 +1332,41 @@ pub unsafe extern "C" fn lancedb_query_result_to_arrow(
     }
 
     let result_box = Box::from_raw(result);
-    let runtime = get_runtime();
 
-    match runtime.block_on(async {
+    match block_on(c"query_result_to_arrow", async {
         let batches: Vec<RecordBatch> = result_box.inner.try_collect().await?;
         Ok::<Vec<RecordBatch>, lancedb::error::Error>(batches)
     }) {
-        Ok(batches) => {
-            let count = batches.len();
-            *count_out = count;
-
-            if count == 0 {
-                *batches_out = ptr::null_mut();
-                *schema_out = ptr::null_mut();
-                return LanceDBError::Success;
-            }
-
-            // Get schema from first batch (all batches have same schema)
-            let schema = batches[0].schema();
-            let ffi_schema = match arrow_schema::ffi::FFI_ArrowSchema::try_from(&*schema) {
-                Ok(schema) => Box::new(schema),
-                Err(err) => {
-                    if !error_message.is_null() {
-                        let error_str = format!("Failed to convert Arrow schema to C ABI: {err}");
-                        if let Ok(c_str) = std::ffi::CString::new(error_str) {
-                            *error_message = c_str.into_raw();
-                        }
-                    }
-                    return LanceDBError::Unknown;
-                }
-            };
-            *schema_out = Box::into_raw(ffi_schema);
-
-            // Allocate array for Arrow C ABI array structures
-            let arrays_ptr =
-                libc::malloc(count * std::mem::size_of::<*mut arrow_array::ffi::FFI_ArrowArray>())
-                    as *mut *mut arrow_array::ffi::FFI_ArrowArray;
-            if arrays_ptr.is_null() {
-                // Clean up schema on allocation failure
-                let _ = Box::from_raw(*schema_out);
-                *schema_out = ptr::null_mut();
-                set_unknown_error_message(error_message);
-                return LanceDBError::Unknown;
-            }
+        Ok(batches) => export_batches(batches, batches_out, schema_out, count_out, error_message),
+        Err(_) => {
+            set_unknown_error_message(error_message);
+            LanceDBError::Unknown
+        }
+    }
+}
 
-            for (i, batch) in batches.into_iter().enumerate() {
-                // Convert RecordBatch to StructArray first, then to FFI_ArrowArray
-                let struct_array: StructArray = batch.clone().into();
-                let array_data: ArrayData = struct_array.into_data();
-                let ffi_array = Box::new(FFI_ArrowArray::new(&array_data));
-                *arrays_ptr.add(i) = Box::into_raw(ffi_array);
-            }
+/// Get the schema of a query result
+///
+/// # Safety
+/// - `result` must be a valid pointer returned from query execution functions
+/// - `schema_out` must be a valid pointer to receive the Arrow schema
+/// - `error_message` can be NULL to ignore detailed error messages
+/// - Caller must free the returned schema with `lancedb_free_arrow_schema`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_query_result_schema(
+    result: *const LanceDBQueryResult,
+    schema_out: *mut *mut arrow_schema::ffi::FFI_ArrowSchema,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if result.is_null() || schema_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
 
-            *batches_out = arrays_ptr;
+    let schema = (*result).inner.schema();
+    match arrow_schema::ffi::FFI_ArrowSchema::try_from(&*schema) {
+        Ok(ffi_schema) => {
+            *schema_out = Box::into_raw(Box::new(ffi_schema));
             LanceDBError::Success
         }
         Err(_) => {
@@ -657,6 +1376,119 @@ pub unsafe extern "C" fn lancedb_query_result_to_arrow(
     }
 }
 
+/// Fetch the next batch from a query result
+///
+/// # Safety
+/// - `result` must be a valid pointer returned from query execution functions
+/// - `array_out` must be a valid pointer to receive the Arrow array
+/// - `error_message` can be NULL to ignore detailed error messages
+/// - `*array_out` is set to NULL once the result is exhausted
+/// - Caller must free each returned array with `lancedb_free_arrow_array`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_query_result_next_batch(
+    result: *mut LanceDBQueryResult,
+    array_out: *mut *mut FFI_ArrowArray,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if result.is_null() || array_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    *array_out = ptr::null_mut();
+    let stream = &mut (*result).inner;
+
+    match block_on(c"query_result_next_batch", stream.next()) {
+        Some(Ok(batch)) => {
+            *array_out = Box::into_raw(Box::new(batch_to_ffi_array(batch)));
+            LanceDBError::Success
+        }
+        Some(Err(e)) => handle_error(&e, error_message),
+        None => LanceDBError::Success,
+    }
+}
+
+/// Fetch the next batches from a query result into caller-allocated arrays
+///
+/// # Safety
+/// - `result` must be a valid pointer returned from query execution functions
+/// - `arrays_out` must point to `capacity` writable Arrow C ABI array structures
+/// - `count_out` must be a valid pointer to receive the number of batches written
+/// - `error_message` can be NULL to ignore detailed error messages
+/// - Fewer than `capacity` batches are written only once the result is exhausted
+/// - Caller must release each written array through its `release` callback
+/// - On error no arrays are handed over: batches fetched before the error are released,
+///   their slots are left released, and `count_out` is 0
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_query_result_next_batches(
+    result: *mut LanceDBQueryResult,
+    arrays_out: *mut FFI_ArrowArray,
+    capacity: usize,
+    count_out: *mut usize,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if result.is_null() || arrays_out.is_null() || capacity == 0 || count_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    *count_out = 0;
+    let stream = &mut (*result).inner;
+
+    block_on(c"query_result_next_batches", async {
+        while *count_out < capacity {
+            match stream.next().await {
+                Some(Ok(batch)) => {
+                    ptr::write(arrays_out.add(*count_out), batch_to_ffi_array(batch));
+                    *count_out += 1;
+                }
+                Some(Err(e)) => return Err(e),
+                None => break,
+            }
+        }
+        Ok(())
+    })
+    .map_or_else(
+        |e| {
+            for i in 0..*count_out {
+                drop(ptr::replace(arrays_out.add(i), FFI_ArrowArray::empty()));
+            }
+            *count_out = 0;
+            handle_error(&e, error_message)
+        },
+        |_| LanceDBError::Success,
+    )
+}
+
+/// Export query result as an Arrow C stream
+///
+/// # Safety
+/// - `result` must be a valid pointer returned from query execution functions
+/// - `stream_out` must be a valid pointer to an uninitialized ArrowArrayStream structure
+/// - `error_message` can be NULL to ignore detailed error messages
+/// - This function consumes the result pointer; do not use it after calling
+/// - Caller must release the stream through its `release` callback
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_query_result_to_arrow_stream(
+    result: *mut LanceDBQueryResult,
+    stream_out: *mut FFI_ArrowArrayStream,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if result.is_null() || stream_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let result_box = Box::from_raw(result);
+    let reader = QueryResultReader {
+        schema: result_box.inner.schema(),
+        stream: result_box.inner,
+    };
+
+    ptr::write(stream_out, FFI_ArrowArrayStream::new(Box::new(reader)));
+    LanceDBError::Success
+}
+
 /// Free a Query
 ///
 /// # Safety
@@ -693,6 +1525,18 @@ pub unsafe extern "C" fn lancedb_query_result_free(result: *mut LanceDBQueryResu
     }
 }
 
+/// Free a single Arrow array returned by `lancedb_query_result_next_batch`
+///
+/// # Safety
+/// - `array` must be a pointer returned by `lancedb_query_result_next_batch`
+/// - `array` must not be used after calling this function
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_free_arrow_array(array: *mut arrow_array::ffi::FFI_ArrowArray) {
+    if !array.is_null() {
+        let _ = Box::from_raw(array);
+    }
+}
+
 /// Free Arrow arrays returned by query result functions
 ///
 /// # Safety
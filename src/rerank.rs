@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The LanceDB Authors
+
+//! Reranker configuration for hybrid (vector + full-text) queries
+//!
+//! Hybrid queries run the vector and full-text searches in one query and combine
+//! both result sets with a reranker inside LanceDB.
+
+use std::collections::HashMap;
+use std::os::raw::c_float;
+use std::sync::Arc;
+
+use arrow::compute::{sort_to_indices, take, SortOptions};
+use arrow_array::cast::AsArray;
+use arrow_array::types::{Float32Type, UInt64Type};
+use arrow_array::{Float32Array, RecordBatch};
+use arrow_schema::{DataType, Field, Schema};
+use async_trait::async_trait;
+use lancedb::rerankers::rrf::RRFReranker;
+use lancedb::rerankers::{NormalizeMethod, Reranker};
+
+/// Reranker type enum for C API
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub enum LanceDBRerankerType {
+    Rrf = 0,
+    Linear = 1,
+}
+
+/// Score normalization applied before reranking
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub enum LanceDBNormalizeMethod {
+    Score = 0,
+    Rank = 1,
+}
+
+impl From<LanceDBNormalizeMethod> for NormalizeMethod {
+    fn from(method: LanceDBNormalizeMethod) -> Self {
+        match method {
+            LanceDBNormalizeMethod::Score => Self::Score,
+            LanceDBNormalizeMethod::Rank => Self::Rank,
+        }
+    }
+}
+
+/// Configuration for hybrid query rerankers
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct LanceDBRerankerConfig {
+    pub reranker_type: LanceDBRerankerType, // Reranker combining both result sets
+    pub rrf_k: c_float,                     // RRF rank constant (0.0 = default 60)
+    pub linear_weight: c_float, // Weight of the vector score for linear reranking (< 0.0 = default 0.7)
+    pub normalize: LanceDBNormalizeMethod, // Normalization of scores before reranking
+}
+
+impl Default for LanceDBRerankerConfig {
+    fn default() -> Self {
+        Self {
+            reranker_type: LanceDBRerankerType::Rrf,
+            rrf_k: 0.0,
+            linear_weight: -1.0,
+            normalize: LanceDBNormalizeMethod::Score,
+        }
+    }
+}
+
+impl LanceDBRerankerConfig {
+    /// Build the reranker described by this configuration
+    pub(crate) fn reranker(&self) -> Arc<dyn Reranker> {
+        match self.reranker_type {
+            LanceDBRerankerType::Rrf if self.rrf_k > 0.0 => Arc::new(RRFReranker::new(self.rrf_k)),
+            LanceDBRerankerType::Rrf => Arc::new(RRFReranker::default()),
+            LanceDBRerankerType::Linear => Arc::new(LinearCombinationReranker {
+                weight: if self.linear_weight < 0.0 {
+                    0.7
+                } else {
+                    self.linear_weight.min(1.0)
+                },
+            }),
+        }
+    }
+}
+
+const ROW_ID: &str = "_rowid";
+const DISTANCE: &str = "_distance";
+const SCORE: &str = "_score";
+const RELEVANCE_SCORE: &str = "_relevance_score";
+
+/// Reranker combining normalized vector and full-text scores linearly
+///
+/// The relevance of a row is `weight * (1 - distance) + (1 - weight) * score`, where
+/// a row found by only one of the searches gets zero for the other part.
+#[derive(Debug)]
+struct LinearCombinationReranker {
+    weight: f32,
+}
+
+#[async_trait]
+impl Reranker for LinearCombinationReranker {
+    async fn rerank_hybrid(
+        &self,
+        _query: &str,
+        vector_results: RecordBatch,
+        fts_results: RecordBatch,
+    ) -> lancedb::error::Result<RecordBatch> {
+        let mut scores: HashMap<u64, f32> = HashMap::new();
+        for (batch, column, vector) in [
+            (&vector_results, DISTANCE, true),
+            (&fts_results, SCORE, false),
+        ] {
+            let (Some(row_ids), Some(values)) =
+                (batch.column_by_name(ROW_ID), batch.column_by_name(column))
+            else {
+                return Err(lancedb::error::Error::InvalidInput {
+                    message: format!("hybrid results are missing the {ROW_ID} or {column} column"),
+                });
+            };
+            let (Some(row_ids), Some(values)) = (
+                row_ids.as_primitive_opt::<UInt64Type>(),
+                values.as_primitive_opt::<Float32Type>(),
+            ) else {
+                return Err(lancedb::error::Error::InvalidInput {
+                    message: format!(
+                        "hybrid results need a UInt64 {ROW_ID} and a Float32 {column} column"
+                    ),
+                });
+            };
+            for (row_id, value) in row_ids.values().iter().zip(values.values().iter()) {
+                let score = if vector {
+                    self.weight * (1.0 - value)
+                } else {
+                    (1.0 - self.weight) * value
+                };
+                *scores.entry(*row_id).or_insert(0.0) += score;
+            }
+        }
+
+        let combined = self.merge_results(vector_results, fts_results)?;
+        let combined_row_ids = combined
+            .column_by_name(ROW_ID)
+            .and_then(|column| column.as_primitive_opt::<UInt64Type>().cloned())
+            .ok_or_else(|| lancedb::error::Error::InvalidInput {
+                message: format!("hybrid results are missing a UInt64 {ROW_ID} column"),
+            })?;
+        let relevance_scores = Float32Array::from_iter_values(
+            combined_row_ids
+                .values()
+                .iter()
+                .map(|row_id| scores.get(row_id).copied().unwrap_or(0.0)),
+        );
+
+        // Order rows by descending relevance
+        let sort_indices = sort_to_indices(
+            &relevance_scores,
+            Some(SortOptions {
+                descending: true,
+                ..Default::default()
+            }),
+            None,
+        )?;
+
+        let mut columns = combined.columns().to_vec();
+        columns.push(Arc::new(relevance_scores));
+        let columns = columns
+            .iter()
+            .map(|column| take(column.as_ref(), &sort_indices, None))
+            .collect::<Result<Vec<_>, _>>()?;
+
+        let mut fields = combined.schema().fields().to_vec();
+        fields.push(Arc::new(Field::new(
+            RELEVANCE_SCORE,
+            DataType::Float32,
+            false,
+        )));
+        Ok(RecordBatch::try_new(
+            Arc::new(Schema::new(fields)),
+            columns,
+        )?)
+    }
+}
@@ -0,0 +1,725 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright The LanceDB Authors
+
+//! Object store tuning and local disk cache for LanceDB C bindings
+//!
+//! The tuned settings are applied to every remote object store opened through the
+//! connection's Lance session. Stores are wrapped at the registry, so the lancedb connect
+//! path and datasets opened directly by the bindings pick them up alike.
+//!
+//! The disk cache keeps byte ranges read from immutable Lance files (data, index and
+//! deletion files, whose paths are never rewritten) in a local directory, up to a size cap.
+//! Manifests and other mutable files are always read from the store.
+
+use std::collections::{BTreeMap, HashMap};
+use std::ffi::CStr;
+use std::fmt;
+use std::mem;
+use std::ops::Range;
+use std::os::raw::{c_char, c_uint};
+use std::path::PathBuf;
+use std::ptr;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Arc, Mutex};
+
+use async_trait::async_trait;
+use bytes::Bytes;
+use futures::stream::BoxStream;
+use futures::StreamExt;
+use lance_io::object_store::{
+    ObjectStore as LanceObjectStore, ObjectStoreParams, ObjectStoreProvider, ObjectStoreRegistry,
+};
+use object_store::path::Path;
+use object_store::{
+    Attributes, GetOptions, GetRange, GetResult, GetResultPayload, ListResult, MultipartUpload,
+    ObjectMeta, ObjectStore, PutMultipartOpts, PutOptions, PutPayload, PutResult,
+};
+use url::Url;
+
+/// Schemes of the remote stores that are tuned and cached
+const REMOTE_SCHEMES: [&str; 5] = ["s3", "s3+ddb", "gs", "az", "oss"];
+
+/// Object store configuration
+///
+/// Versioned by `struct_size`: fields beyond the size passed by the caller take their
+/// defaults, so callers built against an older header keep working when fields are added.
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct LanceDBObjectStoreConfig {
+    pub struct_size: usize, // Size of the struct, set by lancedb_object_store_config_init
+    pub max_concurrent_requests: c_uint, // Concurrent requests per store (0 = Lance default)
+    pub block_size: u64,    // Bytes; nearby reads within this gap are merged (0 = Lance default)
+    pub max_request_size: u64, // Bytes; larger reads are split (0 = Lance default of 16 MiB)
+    pub request_timeout_ms: u64, // Timeout of a single request (0 = default of 30 s)
+    pub connect_timeout_ms: u64, // Timeout for establishing a connection (0 = default of 5 s)
+    pub max_retries: c_uint, // Retries of a failed request (0 = default of 10)
+    pub retry_timeout_ms: u64, // Total time spent retrying a request (0 = default of 180 s)
+    pub disk_cache_path: *const c_char, // Directory of the local disk cache (NULL = no disk cache)
+    pub disk_cache_bytes: u64, // Size cap of the disk cache (0 = no disk cache)
+}
+
+impl Default for LanceDBObjectStoreConfig {
+    fn default() -> Self {
+        Self {
+            struct_size: mem::size_of::<Self>(),
+            max_concurrent_requests: 0,
+            block_size: 0,
+            max_request_size: 0,
+            request_timeout_ms: 0,
+            connect_timeout_ms: 0,
+            max_retries: 0,
+            retry_timeout_ms: 0,
+            disk_cache_path: ptr::null(),
+            disk_cache_bytes: 0,
+        }
+    }
+}
+
+impl LanceDBObjectStoreConfig {
+    /// Copy the fields known to both the caller and this library
+    ///
+    /// Returns None if the caller's struct is too small to hold `struct_size`.
+    pub(crate) unsafe fn from_c(config: *const Self) -> Option<Self> {
+        let mut out = Self::default();
+        if config.is_null() {
+            return Some(out);
+        }
+
+        let size = (*config).struct_size;
+        if size < mem::size_of::<usize>() {
+            return None;
+        }
+        ptr::copy_nonoverlapping(
+            config as *const u8,
+            &mut out as *mut Self as *mut u8,
+            size.min(mem::size_of::<Self>()),
+        );
+        out.struct_size = mem::size_of::<Self>();
+        Some(out)
+    }
+}
+
+/// Owned object store settings of a connection
+#[derive(Debug, Default, Clone)]
+pub(crate) struct ObjectStoreConfig {
+    max_concurrent_requests: usize,
+    block_size: usize,
+    max_request_size: u64,
+    disk_cache: Option<(PathBuf, u64)>,
+}
+
+impl ObjectStoreConfig {
+    /// Settings of `config` and the storage options carrying its timeouts and retries
+    ///
+    /// Returns a message if the disk cache path is not valid UTF-8.
+    pub(crate) unsafe fn from_c(
+        config: &LanceDBObjectStoreConfig,
+    ) -> Result<(Self, Vec<(&'static str, String)>), &'static str> {
+        let disk_cache = if config.disk_cache_path.is_null() || config.disk_cache_bytes == 0 {
+            None
+        } else {
+            let Ok(path) = CStr::from_ptr(config.disk_cache_path).to_str() else {
+                return Err("disk_cache_path is not valid UTF-8");
+            };
+            Some((PathBuf::from(path), config.disk_cache_bytes))
+        };
+
+        let mut storage_options = Vec::new();
+        if config.request_timeout_ms > 0 {
+            storage_options.push(("timeout", format!("{}ms", config.request_timeout_ms)));
+        }
+        if config.connect_timeout_ms > 0 {
+            storage_options.push((
+                "connect_timeout",
+                format!("{}ms", config.connect_timeout_ms),
+            ));
+        }
+        if config.max_retries > 0 {
+            storage_options.push(("client_max_retries", config.max_retries.to_string()));
+        }
+        if config.retry_timeout_ms > 0 {
+            // Lance takes the retry timeout in whole seconds
+            storage_options.push((
+                "client_retry_timeout",
+                config.retry_timeout_ms.div_ceil(1000).to_string(),
+            ));
+        }
+
+        Ok((
+            Self {
+                max_concurrent_requests: config.max_concurrent_requests as usize,
+                block_size: config.block_size as usize,
+                max_request_size: config.max_request_size,
+                disk_cache,
+            },
+            storage_options,
+        ))
+    }
+
+    /// Store registry applying these settings to the remote stores
+    ///
+    /// Fails if the disk cache directory cannot be created.
+    pub(crate) fn registry(&self) -> std::io::Result<Arc<ObjectStoreRegistry>> {
+        let cache = match &self.disk_cache {
+            Some((path, capacity)) => Some(Arc::new(DiskCache::new(path, *capacity)?)),
+            None => None,
+        };
+
+        let registry = ObjectStoreRegistry::default();
+        for scheme in REMOTE_SCHEMES {
+            if let Some(inner) = registry.get_provider(scheme) {
+                registry.insert(
+                    scheme,
+                    Arc::new(TunedStoreProvider {
+                        inner,
+                        config: self.clone(),
+                        cache: cache.clone(),
+                    }),
+                );
+            }
+        }
+        Ok(Arc::new(registry))
+    }
+}
+
+/// Provider applying the connection's settings to the stores of another provider
+#[derive(Debug)]
+struct TunedStoreProvider {
+    inner: Arc<dyn ObjectStoreProvider>,
+    config: ObjectStoreConfig,
+    cache: Option<Arc<DiskCache>>,
+}
+
+#[async_trait]
+impl ObjectStoreProvider for TunedStoreProvider {
+    async fn new_store(
+        &self,
+        base_path: Url,
+        params: &ObjectStoreParams,
+    ) -> lance::Result<LanceObjectStore> {
+        let mut store = self.inner.new_store(base_path, params).await?;
+        if self.config.max_concurrent_requests > 0 {
+            store.set_io_parallelism(self.config.max_concurrent_requests);
+        }
+        if self.config.block_size > 0 {
+            store.set_block_size(self.config.block_size);
+        }
+        if self.config.max_request_size > 0 {
+            store.set_max_iop_size(self.config.max_request_size);
+        }
+        if let Some(cache) = &self.cache {
+            store.inner = Arc::new(CachedStore {
+                inner: store.inner.clone(),
+                cache: cache.clone(),
+            });
+        }
+        Ok(store)
+    }
+}
+
+/// Whether `location` is a Lance file that is never rewritten once written
+fn is_immutable(location: &Path) -> bool {
+    matches!(
+        location.extension(),
+        Some("lance" | "idx" | "arrow" | "bin")
+    )
+}
+
+/// Cached range of a file
+struct CacheEntry {
+    file: PathBuf,
+    size: u64,
+    last_used: u64,
+    // Metadata of the file, if the range was read with `get_opts`
+    meta: Option<ObjectMeta>,
+}
+
+/// Cached ranges, with their keys ordered from least to most recently used
+#[derive(Default)]
+struct CacheState {
+    entries: HashMap<String, CacheEntry>,
+    lru: BTreeMap<u64, String>,
+    used_bytes: u64,
+    clock: u64,
+}
+
+/// Size-capped local directory of cached byte ranges
+///
+/// Each cache owns a directory of its own below the configured path, removed when the
+/// cache is dropped, so connections sharing a path never read each other's files.
+struct DiskCache {
+    dir: PathBuf,
+    capacity: u64,
+    next_file: AtomicU64,
+    state: Mutex<CacheState>,
+}
+
+impl fmt::Debug for DiskCache {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_struct("DiskCache")
+            .field("dir", &self.dir)
+            .field("capacity", &self.capacity)
+            .finish()
+    }
+}
+
+impl DiskCache {
+    fn new(path: &std::path::Path, capacity: u64) -> std::io::Result<Self> {
+        static NEXT_CACHE: AtomicU64 = AtomicU64::new(0);
+        let dir = path.join(format!(
+            "lancedb-cache-{}-{}",
+            std::process::id(),
+            NEXT_CACHE.fetch_add(1, Ordering::Relaxed)
+        ));
+        std::fs::create_dir_all(&dir)?;
+        Ok(Self {
+            dir,
+            capacity,
+            next_file: AtomicU64::new(0),
+            state: Mutex::new(CacheState::default()),
+        })
+    }
+
+    fn key(location: &Path, range: &Range<u64>) -> String {
+        format!("{}:{}-{}", location, range.start, range.end)
+    }
+
+    /// File holding the cached range and its file's metadata, marked as most recently used
+    fn lookup(&self, key: &str) -> Option<(PathBuf, Option<ObjectMeta>)> {
+        let mut state = self.state.lock().unwrap();
+        state.clock += 1;
+        let clock = state.clock;
+        let entry = state.entries.get_mut(key)?;
+        let previous = mem::replace(&mut entry.last_used, clock);
+        let found = (entry.file.clone(), entry.meta.clone());
+        state.lru.remove(&previous);
+        state.lru.insert(clock, key.to_string());
+        Some(found)
+    }
+
+    /// Write a range to the cache, evicting least recently used ranges to make room
+    fn insert(&self, key: String, data: &Bytes, meta: Option<ObjectMeta>) {
+        let size = data.len() as u64;
+        if size == 0 || size > self.capacity {
+            return;
+        }
+
+        let file = self.dir.join(format!(
+            "{}.bin",
+            self.next_file.fetch_add(1, Ordering::Relaxed)
+        ));
+        if std::fs::write(&file, data).is_err() {
+            let _ = std::fs::remove_file(&file);
+            return;
+        }
+
+        let mut evicted = Vec::new();
+        {
+            let mut state = self.state.lock().unwrap();
+            if let Some(entry) = state.entries.get_mut(&key) {
+                if entry.meta.is_none() {
+                    entry.meta = meta;
+                }
+                evicted.push(file);
+            } else {
+                while state.used_bytes + size > self.capacity {
+                    let Some((_, oldest)) = state.lru.pop_first() else {
+                        break;
+                    };
+                    if let Some(entry) = state.entries.remove(&oldest) {
+                        state.used_bytes -= entry.size;
+                        evicted.push(entry.file);
+                    }
+                }
+                state.clock += 1;
+                let clock = state.clock;
+                state.lru.insert(clock, key.clone());
+                state.used_bytes += size;
+                state.entries.insert(
+                    key,
+                    CacheEntry {
+                        file,
+                        size,
+                        last_used: clock,
+                        meta,
+                    },
+                );
+            }
+        }
+        // Readers of an evicted file fall back to the store
+        for file in evicted {
+            let _ = std::fs::remove_file(file);
+        }
+    }
+}
+
+impl Drop for DiskCache {
+    fn drop(&mut self) {
+        let _ = std::fs::remove_dir_all(&self.dir);
+    }
+}
+
+/// Store reading ranges of immutable files through the disk cache
+#[derive(Debug)]
+struct CachedStore {
+    inner: Arc<dyn ObjectStore>,
+    cache: Arc<DiskCache>,
+}
+
+impl CachedStore {
+    /// Cached bytes of a range and metadata of its file, if the range is in the cache
+    async fn read_cached(
+        &self,
+        key: &str,
+        range: &Range<u64>,
+    ) -> Option<(Bytes, Option<ObjectMeta>)> {
+        let (file, meta) = self.cache.lookup(key)?;
+        let expected = range.end - range.start;
+        match tokio::task::spawn_blocking(move || std::fs::read(file)).await {
+            Ok(Ok(data)) if data.len() as u64 == expected => Some((Bytes::from(data), meta)),
+            // Evicted or truncated meanwhile, read from the store instead
+            _ => None,
+        }
+    }
+
+    /// Write a range to the cache in the background, so the read does not wait for the disk
+    fn write_cached(&self, key: String, data: Bytes, meta: Option<ObjectMeta>) {
+        let cache = self.cache.clone();
+        tokio::task::spawn_blocking(move || cache.insert(key, &data, meta));
+    }
+
+    async fn cached_range(
+        &self,
+        location: &Path,
+        range: Range<u64>,
+    ) -> object_store::Result<Bytes> {
+        let key = DiskCache::key(location, &range);
+        if let Some((data, _)) = self.read_cached(&key, &range).await {
+            return Ok(data);
+        }
+
+        let data = self.inner.get_range(location, range).await?;
+        self.write_cached(key, data.clone(), None);
+        Ok(data)
+    }
+}
+
+/// Whether `options` only select a byte range, without conditions on the object
+fn is_plain_range_read(options: &GetOptions) -> bool {
+    options.if_match.is_none()
+        && options.if_none_match.is_none()
+        && options.if_modified_since.is_none()
+        && options.if_unmodified_since.is_none()
+        && options.version.is_none()
+        && !options.head
+}
+
+/// Result of a ranged get whose data is already in memory
+fn buffered_result(
+    meta: ObjectMeta,
+    range: Range<u64>,
+    data: Bytes,
+    attributes: Attributes,
+) -> GetResult {
+    GetResult {
+        payload: GetResultPayload::Stream(futures::stream::once(async move { Ok(data) }).boxed()),
+        meta,
+        range,
+        attributes,
+    }
+}
+
+impl fmt::Display for CachedStore {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        write!(f, "DiskCached({})", self.inner)
+    }
+}
+
+#[async_trait]
+impl ObjectStore for CachedStore {
+    async fn put_opts(
+        &self,
+        location: &Path,
+        payload: PutPayload,
+        opts: PutOptions,
+    ) -> object_store::Result<PutResult> {
+        self.inner.put_opts(location, payload, opts).await
+    }
+
+    async fn put_multipart_opts(
+        &self,
+        location: &Path,
+        opts: PutMultipartOpts,
+    ) -> object_store::Result<Box<dyn MultipartUpload>> {
+        self.inner.put_multipart_opts(location, opts).await
+    }
+
+    async fn get_opts(
+        &self,
+        location: &Path,
+        options: GetOptions,
+    ) -> object_store::Result<GetResult> {
+        // Lance reads ranges of files through get_opts, so bounded reads go through the cache
+        let range = match &options.range {
+            Some(GetRange::Bounded(range))
+                if is_immutable(location) && is_plain_range_read(&options) =>
+            {
+                range.clone()
+            }
+            _ => return self.inner.get_opts(location, options).await,
+        };
+
+        let key = DiskCache::key(location, &range);
+        // Ranges cached by get_range lack the metadata a GetResult carries
+        if let Some((data, Some(meta))) = self.read_cached(&key, &range).await {
+            return Ok(buffered_result(meta, range, data, Attributes::default()));
+        }
+
+        let result = self.inner.get_opts(location, options).await?;
+        let (meta, range, attributes) = (
+            result.meta.clone(),
+            result.range.clone(),
+            result.attributes.clone(),
+        );
+        let data = result.bytes().await?;
+        self.write_cached(key, data.clone(), Some(meta.clone()));
+        Ok(buffered_result(meta, range, data, attributes))
+    }
+
+    async fn get_range(&self, location: &Path, range: Range<u64>) -> object_store::Result<Bytes> {
+        if !is_immutable(location) {
+            return self.inner.get_range(location, range).await;
+        }
+        self.cached_range(location, range).await
+    }
+
+    async fn get_ranges(
+        &self,
+        location: &Path,
+        ranges: &[Range<u64>],
+    ) -> object_store::Result<Vec<Bytes>> {
+        if !is_immutable(location) {
+            return self.inner.get_ranges(location, ranges).await;
+        }
+        futures::future::try_join_all(
+            ranges
+                .iter()
+                .map(|range| self.cached_range(location, range.clone())),
+        )
+        .await
+    }
+
+    async fn head(&self, location: &Path) -> object_store::Result<ObjectMeta> {
+        self.inner.head(location).await
+    }
+
+    async fn delete(&self, location: &Path) -> object_store::Result<()> {
+        self.inner.delete(location).await
+    }
+
+    fn list(&self, prefix: Option<&Path>) -> BoxStream<'static, object_store::Result<ObjectMeta>> {
+        self.inner.list(prefix)
+    }
+
+    async fn list_with_delimiter(&self, prefix: Option<&Path>) -> object_store::Result<ListResult> {
+        self.inner.list_with_delimiter(prefix).await
+    }
+
+    async fn copy(&self, from: &Path, to: &Path) -> object_store::Result<()> {
+        self.inner.copy(from, to).await
+    }
+
+    async fn copy_if_not_exists(&self, from: &Path, to: &Path) -> object_store::Result<()> {
+        self.inner.copy_if_not_exists(from, to).await
+    }
+}
+
+/// Initialize an object store configuration with defaults
+///
+/// # Safety
+/// - `config` must be a valid pointer to LanceDBObjectStoreConfig
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_object_store_config_init(config: *mut LanceDBObjectStoreConfig) {
+    if !config.is_null() {
+        *config = LanceDBObjectStoreConfig::default();
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use std::sync::atomic::AtomicUsize;
+    use std::time::Duration;
+
+    use object_store::memory::InMemory;
+
+    use super::*;
+
+    /// In-memory store counting the reads that reach it
+    #[derive(Debug)]
+    struct CountingStore {
+        inner: InMemory,
+        reads: AtomicUsize,
+    }
+
+    impl fmt::Display for CountingStore {
+        fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+            write!(f, "Counting({})", self.inner)
+        }
+    }
+
+    #[async_trait]
+    impl ObjectStore for CountingStore {
+        async fn put_opts(
+            &self,
+            location: &Path,
+            payload: PutPayload,
+            opts: PutOptions,
+        ) -> object_store::Result<PutResult> {
+            self.inner.put_opts(location, payload, opts).await
+        }
+
+        async fn put_multipart_opts(
+            &self,
+            location: &Path,
+            opts: PutMultipartOpts,
+        ) -> object_store::Result<Box<dyn MultipartUpload>> {
+            self.inner.put_multipart_opts(location, opts).await
+        }
+
+        async fn get_opts(
+            &self,
+            location: &Path,
+            options: GetOptions,
+        ) -> object_store::Result<GetResult> {
+            self.reads.fetch_add(1, Ordering::Relaxed);
+            self.inner.get_opts(location, options).await
+        }
+
+        async fn get_range(
+            &self,
+            location: &Path,
+            range: Range<u64>,
+        ) -> object_store::Result<Bytes> {
+            self.reads.fetch_add(1, Ordering::Relaxed);
+            self.inner.get_range(location, range).await
+        }
+
+        async fn delete(&self, location: &Path) -> object_store::Result<()> {
+            self.inner.delete(location).await
+        }
+
+        fn list(
+            &self,
+            prefix: Option<&Path>,
+        ) -> BoxStream<'static, object_store::Result<ObjectMeta>> {
+            self.inner.list(prefix)
+        }
+
+        async fn list_with_delimiter(
+            &self,
+            prefix: Option<&Path>,
+        ) -> object_store::Result<ListResult> {
+            self.inner.list_with_delimiter(prefix).await
+        }
+
+        async fn copy(&self, from: &Path, to: &Path) -> object_store::Result<()> {
+            self.inner.copy(from, to).await
+        }
+
+        async fn copy_if_not_exists(&self, from: &Path, to: &Path) -> object_store::Result<()> {
+            self.inner.copy_if_not_exists(from, to).await
+        }
+    }
+
+    /// Cached store over a counting store holding `data/0.lance` and `_versions/1.manifest`
+    async fn cached_store() -> (Arc<CountingStore>, CachedStore) {
+        let counting = Arc::new(CountingStore {
+            inner: InMemory::new(),
+            reads: AtomicUsize::new(0),
+        });
+        for name in ["data/0.lance", "_versions/1.manifest"] {
+            counting
+                .put(&Path::from(name), PutPayload::from_static(b"0123456789"))
+                .await
+                .unwrap();
+        }
+        let cache = DiskCache::new(&std::env::temp_dir(), 1024).unwrap();
+        let store = CachedStore {
+            inner: counting.clone(),
+            cache: Arc::new(cache),
+        };
+        (counting, store)
+    }
+
+    /// Wait for the background cache write of `count` ranges
+    async fn wait_for_entries(store: &CachedStore, count: usize) {
+        for _ in 0..500 {
+            if store.cache.state.lock().unwrap().entries.len() >= count {
+                return;
+            }
+            tokio::time::sleep(Duration::from_millis(10)).await;
+        }
+        panic!("ranges were not cached");
+    }
+
+    fn ranged(range: Range<u64>) -> GetOptions {
+        GetOptions {
+            range: Some(GetRange::Bounded(range)),
+            ..Default::default()
+        }
+    }
+
+    #[test]
+    fn ranged_reads_of_immutable_files_hit_the_cache() {
+        let runtime = tokio::runtime::Runtime::new().unwrap();
+        runtime.block_on(async {
+            let (counting, store) = cached_store().await;
+            let data = Path::from("data/0.lance");
+
+            let first = store.get_opts(&data, ranged(2..6)).await.unwrap();
+            assert_eq!(first.range, 2..6);
+            assert_eq!(first.bytes().await.unwrap(), Bytes::from_static(b"2345"));
+            wait_for_entries(&store, 1).await;
+
+            let second = store.get_opts(&data, ranged(2..6)).await.unwrap();
+            assert_eq!(second.meta.size, 10);
+            assert_eq!(second.bytes().await.unwrap(), Bytes::from_static(b"2345"));
+            assert_eq!(
+                store.get_range(&data, 2..6).await.unwrap(),
+                Bytes::from_static(b"2345")
+            );
+            assert_eq!(counting.reads.load(Ordering::Relaxed), 1);
+
+            let ranges = store.get_ranges(&data, &[2..6, 7..9]).await.unwrap();
+            assert_eq!(
+                ranges,
+                vec![Bytes::from_static(b"2345"), Bytes::from_static(b"78")]
+            );
+            assert_eq!(counting.reads.load(Ordering::Relaxed), 2);
+        });
+    }
+
+    #[test]
+    fn mutable_files_and_conditional_reads_bypass_the_cache() {
+        let runtime = tokio::runtime::Runtime::new().unwrap();
+        runtime.block_on(async {
+            let (counting, store) = cached_store().await;
+            let manifest = Path::from("_versions/1.manifest");
+            for _ in 0..2 {
+                store.get_opts(&manifest, ranged(0..4)).await.unwrap();
+            }
+            assert_eq!(counting.reads.load(Ordering::Relaxed), 2);
+
+            let data = Path::from("data/0.lance");
+            for _ in 0..2 {
+                let options = GetOptions {
+                    if_none_match: Some("etag".to_string()),
+                    ..ranged(0..4)
+                };
+                let _ = store.get_opts(&data, options).await;
+            }
+            assert_eq!(counting.reads.load(Ordering::Relaxed), 4);
+            assert!(store.cache.state.lock().unwrap().entries.is_empty());
+        });
+    }
+}
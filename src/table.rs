@@ -6,20 +6,37 @@
 //! This module provides all table operations using Arrow-only APIs,
 //! combining both simple and full table functionality.
 
+use std::collections::{HashSet, VecDeque};
 use std::ffi::CStr;
-use std::os::raw::c_char;
+use std::os::raw::{c_char, c_void};
 use std::ptr;
-
-use arrow_array::{Array, RecordBatch, RecordBatchReader, StructArray};
-use arrow_schema::{ArrowError, Schema};
+use std::sync::{Arc, Mutex};
+use std::time::Instant;
+
+use arrow::compute::filter_record_batch;
+use arrow::row::{OwnedRow, RowConverter, SortField};
+use arrow_array::ffi_stream::{ArrowArrayStreamReader, FFI_ArrowArrayStream};
+use arrow_array::{
+    Array, ArrayRef, BooleanArray, RecordBatch, RecordBatchIterator, RecordBatchReader, StructArray,
+};
+use arrow_schema::{ArrowError, Schema, SchemaRef};
 use futures::TryStreamExt;
+use lance::dataset::transaction::{Operation, Transaction};
+use lance::dataset::{CommitBuilder, InsertBuilder, ProjectionRequest, WriteMode, WriteParams};
 use lancedb::query::{ExecutableQuery, QueryBase};
+use lancedb::table::{OptimizeAction, WriteOptions};
+use lancedb::Table;
 
-use crate::connection::{get_runtime, LanceDBTable};
+use crate::connection::{block_on, LanceDBTable};
 use crate::error::{
     handle_error, set_invalid_argument_message, set_unknown_error_message, LanceDBError,
 };
-use crate::types::{LanceDBMergeInsertConfig, LanceDBRecordBatchReader};
+use crate::fragment::open_dataset;
+use crate::query::{batch_to_ffi_array, nearest_to_all};
+use crate::types::{
+    query_vectors_from_raw, LanceDBMergeInsertConfig, LanceDBMergeInsertDedup,
+    LanceDBRecordBatchReader, LanceDBVectorElementType, LanceDBWriteConfig,
+};
 
 /// Get table schema as Arrow C ABI
 ///
@@ -43,9 +60,8 @@ pub unsafe extern "C" fn lancedb_table_arrow_schema(
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
-    match runtime.block_on(tbl.schema()) {
+    match block_on(c"table_arrow_schema", tbl.schema()) {
         Ok(schema) => {
             // Convert to Arrow C ABI
             let ffi_schema =
@@ -71,24 +87,319 @@ pub unsafe extern "C" fn lancedb_table_add(
     table: *const LanceDBTable,
     reader: *mut LanceDBRecordBatchReader,
     error_message: *mut *mut c_char,
+) -> LanceDBError {
+    lancedb_table_add_with_config(table, reader, ptr::null(), error_message)
+}
+
+/// Add data to table with write configuration
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `reader` must be a valid pointer to LanceDBRecordBatchReader
+/// - `config` can be NULL for default write behavior
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_add_with_config(
+    table: *const LanceDBTable,
+    reader: *mut LanceDBRecordBatchReader,
+    config: *const LanceDBWriteConfig,
+    error_message: *mut *mut c_char,
 ) -> LanceDBError {
     if table.is_null() || reader.is_null() {
         set_invalid_argument_message(error_message);
         return LanceDBError::InvalidArgument;
     }
 
-    let tbl = &(*table).inner;
-    let runtime = get_runtime();
+    // NULL keeps the builder's default write options
+    let cfg = if config.is_null() {
+        None
+    } else {
+        let Some(cfg) = LanceDBWriteConfig::from_c(config) else {
+            set_invalid_argument_message(error_message);
+            return LanceDBError::InvalidArgument;
+        };
+        Some(cfg)
+    };
+    let tbl = (*table).inner.clone();
 
     // Take ownership of the reader
     let reader_box = Box::from_raw(reader);
+    let data = (*table).memory.track_reader(reader_box.into_inner());
 
-    match runtime.block_on(tbl.add(reader_box.into_inner()).execute()) {
+    let result = block_on(c"table_add", add(tbl, data, cfg));
+    (*table).snapshot.invalidate();
+
+    match result {
         Ok(_) => LanceDBError::Success,
         Err(e) => handle_error(&e, error_message),
     }
 }
 
+/// Add data to a table on the shared runtime
+pub(crate) async fn add(
+    table: Table,
+    data: Box<dyn RecordBatchReader + Send>,
+    config: Option<LanceDBWriteConfig>,
+) -> lancedb::error::Result<()> {
+    let mut builder = table.add(data);
+
+    // Apply configuration if provided
+    if let Some(cfg) = config {
+        let mut write_options = WriteOptions::default();
+        write_options.lance_write_params = Some(append_params(&cfg));
+        builder = builder.write_options(write_options);
+    }
+
+    builder.execute().await?;
+    Ok(())
+}
+
+/// Lance parameters appending data with the layout of `config`
+fn append_params(config: &LanceDBWriteConfig) -> WriteParams {
+    let mut params = WriteParams {
+        mode: WriteMode::Append,
+        ..Default::default()
+    };
+    if config.max_rows_per_file > 0 {
+        params.max_rows_per_file = config.max_rows_per_file;
+    }
+    if config.max_rows_per_group > 0 {
+        params.max_rows_per_group = config.max_rows_per_group;
+    }
+    if config.max_bytes_per_file > 0 {
+        params.max_bytes_per_file = config.max_bytes_per_file;
+    }
+    params
+}
+
+/// Merge insert options owned by the operation
+pub(crate) struct MergeInsertOptions {
+    when_matched_update_all: bool,
+    when_matched_update_filter: Option<String>,
+    when_not_matched_insert_all: bool,
+    when_not_matched_by_source_delete: bool,
+    when_not_matched_by_source_delete_filter: Option<String>,
+    source_dedup: LanceDBMergeInsertDedup,
+}
+
+impl Default for MergeInsertOptions {
+    // Default upsert behavior
+    fn default() -> Self {
+        Self {
+            when_matched_update_all: true,
+            when_matched_update_filter: None,
+            when_not_matched_insert_all: true,
+            when_not_matched_by_source_delete: false,
+            when_not_matched_by_source_delete_filter: None,
+            source_dedup: LanceDBMergeInsertDedup::None,
+        }
+    }
+}
+
+impl MergeInsertOptions {
+    /// Copy a C merge insert configuration; NULL selects the default upsert
+    ///
+    /// Returns None if the struct size or a filter is invalid.
+    pub(crate) unsafe fn from_c(config: *const LanceDBMergeInsertConfig) -> Option<Self> {
+        let cfg = LanceDBMergeInsertConfig::from_c(config)?;
+        let optional_string = |ptr: *const c_char| -> Option<Option<String>> {
+            if ptr.is_null() {
+                return Some(None);
+            }
+            CStr::from_ptr(ptr)
+                .to_str()
+                .ok()
+                .map(|s| Some(s.to_string()))
+        };
+
+        Some(Self {
+            when_matched_update_all: cfg.when_matched_update_all != 0,
+            when_matched_update_filter: optional_string(cfg.when_matched_update_filter)?,
+            when_not_matched_insert_all: cfg.when_not_matched_insert_all != 0,
+            when_not_matched_by_source_delete: cfg.when_not_matched_by_source_delete != 0,
+            when_not_matched_by_source_delete_filter: optional_string(
+                cfg.when_not_matched_by_source_delete_filter,
+            )?,
+            source_dedup: cfg.source_dedup,
+        })
+    }
+}
+
+/// Initialize a write configuration with the default data file layout
+///
+/// # Safety
+/// - `config` must be a valid pointer to LanceDBWriteConfig
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_write_config_init(config: *mut LanceDBWriteConfig) {
+    if !config.is_null() {
+        *config = LanceDBWriteConfig::default();
+    }
+}
+
+/// Initialize a merge insert configuration with the default upsert behavior
+///
+/// # Safety
+/// - `config` must be a valid pointer to LanceDBMergeInsertConfig
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_merge_insert_config_init(config: *mut LanceDBMergeInsertConfig) {
+    if !config.is_null() {
+        *config = LanceDBMergeInsertConfig::default();
+    }
+}
+
+/// Merge insert data into a table on the shared runtime
+pub(crate) async fn merge_insert(
+    table: Table,
+    data: Box<dyn RecordBatchReader + Send>,
+    on_columns: Vec<String>,
+    options: MergeInsertOptions,
+) -> lancedb::error::Result<()> {
+    let column_names: Vec<&str> = on_columns.iter().map(String::as_str).collect();
+    let mut merge_builder = table.merge_insert(&column_names);
+
+    if options.when_matched_update_all {
+        merge_builder.when_matched_update_all(options.when_matched_update_filter);
+    }
+    if options.when_not_matched_insert_all {
+        merge_builder.when_not_matched_insert_all();
+    }
+    if options.when_not_matched_by_source_delete {
+        merge_builder
+            .when_not_matched_by_source_delete(options.when_not_matched_by_source_delete_filter);
+    }
+
+    let data = dedup_source(data, &on_columns, options.source_dedup)?;
+    merge_builder.execute(data).await?;
+    Ok(())
+}
+
+/// Drop source rows repeating the merge key of another source row
+fn dedup_source(
+    data: Box<dyn RecordBatchReader + Send>,
+    on_columns: &[String],
+    mode: LanceDBMergeInsertDedup,
+) -> lancedb::error::Result<Box<dyn RecordBatchReader + Send>> {
+    if mode == LanceDBMergeInsertDedup::None {
+        return Ok(data);
+    }
+
+    let schema = data.schema();
+    let key_indices = on_columns
+        .iter()
+        .map(|name| schema.index_of(name))
+        .collect::<Result<Vec<_>, _>>()?;
+    let sort_fields = key_indices
+        .iter()
+        .map(|&i| SortField::new(schema.field(i).data_type().clone()))
+        .collect();
+    let converter = RowConverter::new(sort_fields)?;
+
+    let mut reader = DedupReader {
+        inner: data,
+        key_indices,
+        converter,
+        seen: HashSet::new(),
+    };
+
+    if mode == LanceDBMergeInsertDedup::First {
+        // Keeping the first row of each key can be decided while streaming
+        return Ok(Box::new(reader));
+    }
+
+    // Keeping the last row needs the whole source: scan it backwards keeping first sightings
+    let batches = reader.inner.by_ref().collect::<Result<Vec<_>, _>>()?;
+    let mut masks = Vec::with_capacity(batches.len());
+    for batch in batches.iter().rev() {
+        let mut mask = reader.first_sightings(batch, true)?;
+        mask.reverse();
+        masks.push(BooleanArray::from(mask));
+    }
+    let deduped = batches
+        .iter()
+        .zip(masks.iter().rev())
+        .map(|(batch, mask)| filter_record_batch(batch, mask))
+        .collect::<Vec<_>>();
+
+    Ok(Box::new(RecordBatchIterator::new(deduped, schema)))
+}
+
+/// RecordBatchReader keeping only the first source row of each merge key
+struct DedupReader {
+    inner: Box<dyn RecordBatchReader + Send>,
+    key_indices: Vec<usize>,
+    converter: RowConverter,
+    seen: HashSet<OwnedRow>,
+}
+
+impl DedupReader {
+    /// Flag the rows whose key was not seen before, visiting rows in reverse if asked
+    fn first_sightings(
+        &mut self,
+        batch: &RecordBatch,
+        reverse: bool,
+    ) -> Result<Vec<bool>, ArrowError> {
+        let keys: Vec<ArrayRef> = self
+            .key_indices
+            .iter()
+            .map(|&i| batch.column(i).clone())
+            .collect();
+        let rows = self.converter.convert_columns(&keys)?;
+
+        let order: Box<dyn Iterator<Item = usize>> = if reverse {
+            Box::new((0..rows.num_rows()).rev())
+        } else {
+            Box::new(0..rows.num_rows())
+        };
+        Ok(order
+            .map(|i| self.seen.insert(rows.row(i).owned()))
+            .collect())
+    }
+}
+
+impl Iterator for DedupReader {
+    type Item = Result<RecordBatch, ArrowError>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        let batch = match self.inner.next()? {
+            Ok(batch) => batch,
+            Err(e) => return Some(Err(e)),
+        };
+        Some(
+            self.first_sightings(&batch, false)
+                .and_then(|mask| filter_record_batch(&batch, &BooleanArray::from(mask))),
+        )
+    }
+}
+
+impl RecordBatchReader for DedupReader {
+    fn schema(&self) -> SchemaRef {
+        self.inner.schema()
+    }
+}
+
+/// Extract merge insert key column names from a C string array
+pub(crate) unsafe fn on_columns_from_c(
+    on_columns: *const *const c_char,
+    num_columns: usize,
+) -> Option<Vec<String>> {
+    let mut column_names = Vec::with_capacity(num_columns);
+    for i in 0..num_columns {
+        let col_ptr = *on_columns.add(i);
+        if col_ptr.is_null() {
+            return None;
+        }
+
+        let Ok(col_str) = CStr::from_ptr(col_ptr).to_str() else {
+            return None;
+        };
+        column_names.push(col_str.to_string());
+    }
+    Some(column_names)
+}
+
 /// Merge data into table (upsert operation) using Arrow data
 ///
 /// # Safety
@@ -115,47 +426,29 @@ pub unsafe extern "C" fn lancedb_table_merge_insert(
     }
 
     // Extract column names
-    let mut column_names = Vec::with_capacity(num_columns);
-    for i in 0..num_columns {
-        let col_ptr = *on_columns.add(i);
-        if col_ptr.is_null() {
-            set_invalid_argument_message(error_message);
-            return LanceDBError::InvalidArgument;
-        }
+    let Some(column_names) = on_columns_from_c(on_columns, num_columns) else {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    };
 
-        let Ok(col_str) = CStr::from_ptr(col_ptr).to_str() else {
-            set_invalid_argument_message(error_message);
-            return LanceDBError::InvalidArgument;
-        };
-        column_names.push(col_str);
-    }
+    let tbl = (*table).inner.clone();
 
-    let tbl = &(*table).inner;
-    let runtime = get_runtime();
+    let Some(options) = MergeInsertOptions::from_c(config) else {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    };
 
     // Take ownership of the data reader
     let data_box = Box::from_raw(data);
+    let data = (*table).memory.track_reader(data_box.into_inner());
 
-    match runtime.block_on(async {
-        let mut merge_builder = tbl.merge_insert(&column_names);
-
-        // Apply configuration if provided
-        if !config.is_null() {
-            let cfg = &*config;
-            if cfg.when_matched_update_all != 0 {
-                merge_builder.when_matched_update_all(None);
-            }
-            if cfg.when_not_matched_insert_all != 0 {
-                merge_builder.when_not_matched_insert_all();
-            }
-        } else {
-            // Default upsert behavior
-            merge_builder.when_matched_update_all(None);
-            merge_builder.when_not_matched_insert_all();
-        }
+    let result = block_on(
+        c"table_merge_insert",
+        merge_insert(tbl, data, column_names, options),
+    );
+    (*table).snapshot.invalidate();
 
-        merge_builder.execute(data_box.into_inner()).await
-    }) {
+    match result {
         Ok(_) => LanceDBError::Success,
         Err(e) => handle_error(&e, error_message),
     }
@@ -184,14 +477,32 @@ pub unsafe extern "C" fn lancedb_table_cleanup_old_versions(
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
-    let older_than = chrono::Duration::days(older_than_days as i64);
-    let delete_unverified_bool = delete_unverified != 0;
+    let result = block_on(
+        c"table_cleanup_old_versions",
+        cleanup_old_versions(tbl, older_than_days, delete_unverified != 0),
+    );
+    (*table).snapshot.invalidate();
 
-    // Note: cleanup_old_versions API is simplified in this implementation
-    let _ = (older_than, delete_unverified_bool, tbl, runtime);
-    LanceDBError::Success
+    match result {
+        Ok(_) => LanceDBError::Success,
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
+/// Remove versions older than the given age, together with the files only they reference
+pub(crate) async fn cleanup_old_versions(
+    tbl: &Table,
+    older_than_days: u16,
+    delete_unverified: bool,
+) -> lancedb::error::Result<()> {
+    tbl.optimize(OptimizeAction::Prune {
+        older_than: Some(chrono::Duration::days(older_than_days as i64)),
+        delete_unverified: Some(delete_unverified),
+        error_if_tagged_old_versions: None,
+    })
+    .await
+    .map(|_| ())
 }
 
 /// Compact small files in the table
@@ -213,11 +524,24 @@ pub unsafe extern "C" fn lancedb_table_compact_files(
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
-    // Note: Compaction API is simplified in this implementation
-    let _ = (tbl, runtime);
-    LanceDBError::Success
+    let result = block_on(c"table_compact_files", compact_files(tbl));
+    (*table).snapshot.invalidate();
+
+    match result {
+        Ok(_) => LanceDBError::Success,
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
+/// Rewrite small fragments into larger ones and materialize deletions
+pub(crate) async fn compact_files(tbl: &Table) -> lancedb::error::Result<()> {
+    tbl.optimize(OptimizeAction::Compact {
+        options: Default::default(),
+        remap_options: None,
+    })
+    .await
+    .map(|_| ())
 }
 
 /// Restore table to a specific version
@@ -241,10 +565,9 @@ pub unsafe extern "C" fn lancedb_table_restore_version(
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
     // Note: restore API is simplified in this implementation
-    let _ = (version, tbl, runtime);
+    let _ = (version, tbl);
     LanceDBError::Success
 }
 
@@ -324,6 +647,34 @@ pub unsafe extern "C" fn lancedb_record_batch_reader_from_arrow(
     Box::into_raw(wrapper)
 }
 
+/// Create a RecordBatchReader from an Arrow C stream
+///
+/// Batches are pulled from the stream only as they are written, so an add or merge
+/// insert consumes an arbitrarily long stream in a single commit with bounded memory.
+///
+/// # Safety
+/// - `stream` must be a valid pointer to an initialized FFI_ArrowArrayStream
+/// - The stream is consumed (also on failure) and marked released; the caller must
+///   not call its release function
+///
+/// # Returns
+/// - Pointer to LanceDBRecordBatchReader wrapper, or NULL on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_record_batch_reader_from_arrow_stream(
+    stream: *mut FFI_ArrowArrayStream,
+) -> *mut LanceDBRecordBatchReader {
+    if stream.is_null() || (*stream).release.is_none() {
+        return ptr::null_mut();
+    }
+
+    let reader = match ArrowArrayStreamReader::from_raw(stream) {
+        Ok(reader) => reader,
+        Err(_) => return ptr::null_mut(),
+    };
+
+    Box::into_raw(Box::new(LanceDBRecordBatchReader::new(Box::new(reader))))
+}
+
 /// Free a RecordBatchReader wrapper
 ///
 /// # Safety
@@ -350,6 +701,247 @@ pub unsafe extern "C" fn lancedb_free_arrow_schema(
     }
 }
 
+/* ========== BULK LOAD OPERATIONS ========== */
+
+/// Opaque handle to a bulk load of many readers committed as one table version
+#[repr(C)]
+pub struct LanceDBBulkLoader {
+    table: LanceDBTable,
+    config: Option<LanceDBWriteConfig>,
+    readers: Mutex<Vec<Box<dyn RecordBatchReader + Send>>>,
+}
+
+/// RecordBatchReader yielding the batches of several readers in turn
+struct ChainedReader {
+    schema: SchemaRef,
+    readers: VecDeque<Box<dyn RecordBatchReader + Send>>,
+}
+
+impl Iterator for ChainedReader {
+    type Item = Result<RecordBatch, ArrowError>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        loop {
+            let batch = self.readers.front_mut()?.next();
+            if batch.is_some() {
+                return batch;
+            }
+            self.readers.pop_front();
+        }
+    }
+}
+
+impl RecordBatchReader for ChainedReader {
+    fn schema(&self) -> SchemaRef {
+        self.schema.clone()
+    }
+}
+
+/// Write the fragments of each reader concurrently and commit them as one append
+async fn bulk_load(
+    table: &LanceDBTable,
+    readers: Vec<Box<dyn RecordBatchReader + Send>>,
+    config: Option<LanceDBWriteConfig>,
+) -> lancedb::error::Result<()> {
+    if table.pinned {
+        return Err(lancedb::error::Error::NotSupported {
+            message: "cannot bulk load into a table pinned to a version".to_string(),
+        });
+    }
+
+    if table.inner.as_native().is_none() {
+        // Remote tables only accept whole writes, so send the readers as one stream
+        let schema = readers[0].schema();
+        let data = Box::new(ChainedReader {
+            schema,
+            readers: readers.into(),
+        });
+        return add(table.inner.clone(), data, config).await;
+    }
+
+    table.inner.checkout_latest().await?;
+    let dataset = Arc::new(open_dataset(&table.inner, &table.dataset_options, 0).await?);
+    let params = config
+        .as_ref()
+        .map(append_params)
+        .unwrap_or_else(|| WriteParams {
+            mode: WriteMode::Append,
+            ..Default::default()
+        });
+
+    // Each reader is encoded and written on its own task; nothing is visible until the
+    // commit below, so files of a failed load are left for cleanup of old versions
+    let writes = readers.into_iter().map(|reader| {
+        let dataset = dataset.clone();
+        let params = params.clone();
+        tokio::spawn(async move {
+            InsertBuilder::new(dataset)
+                .with_params(&params)
+                .execute_uncommitted_stream(reader)
+                .await
+        })
+    });
+    let written = futures::future::try_join_all(writes).await.map_err(|e| {
+        lancedb::error::Error::Runtime {
+            message: format!("bulk load write failed: {e}"),
+        }
+    })?;
+
+    let mut transaction: Option<Transaction> = None;
+    for result in written {
+        let next = result?;
+        let Some(base) = transaction.as_mut() else {
+            transaction = Some(next);
+            continue;
+        };
+        match (&mut base.operation, next.operation) {
+            (
+                Operation::Append { fragments, .. },
+                Operation::Append {
+                    fragments: more, ..
+                },
+            ) => fragments.extend(more),
+            _ => {
+                return Err(lancedb::error::Error::Runtime {
+                    message: "bulk load write did not produce an append".to_string(),
+                })
+            }
+        }
+    }
+
+    if let Some(transaction) = transaction {
+        CommitBuilder::new(dataset).execute(transaction).await?;
+        table.inner.checkout_latest().await?;
+    }
+    Ok(())
+}
+
+/// Create a bulk loader for a table
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `config` can be NULL for default write behavior
+///
+/// # Returns
+/// - Non-null pointer to LanceDBBulkLoader on success
+/// - Null pointer if `table` is NULL or `config` is too small to hold its struct_size
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_bulk_load_new(
+    table: *const LanceDBTable,
+    config: *const LanceDBWriteConfig,
+) -> *mut LanceDBBulkLoader {
+    if table.is_null() {
+        return ptr::null_mut();
+    }
+    let cfg = if config.is_null() {
+        None
+    } else {
+        let Some(cfg) = LanceDBWriteConfig::from_c(config) else {
+            return ptr::null_mut();
+        };
+        Some(cfg)
+    };
+
+    let loader = Box::new(LanceDBBulkLoader {
+        table: (*table).clone(),
+        config: cfg,
+        readers: Mutex::new(Vec::new()),
+    });
+
+    Box::into_raw(loader)
+}
+
+/// Queue a reader for the bulk load
+///
+/// Can be called concurrently from several threads. No data is read until the
+/// bulk load is committed.
+///
+/// # Safety
+/// - `loader` must be a valid pointer returned from `lancedb_table_bulk_load_new`
+/// - `reader` must be a valid pointer to LanceDBRecordBatchReader; it is consumed on success
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_bulk_loader_add(
+    loader: *const LanceDBBulkLoader,
+    reader: *mut LanceDBRecordBatchReader,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if loader.is_null() || reader.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let mut readers = (*loader).readers.lock().unwrap();
+    if let Some(first) = readers.first() {
+        if first.schema() != (*reader).schema() {
+            let error = lancedb::error::Error::Schema {
+                message: "bulk load reader schema does not match the first reader".to_string(),
+            };
+            return handle_error(&error, error_message);
+        }
+    }
+
+    let reader = Box::from_raw(reader).into_inner();
+    readers.push((*loader).table.memory.track_reader(reader));
+    LanceDBError::Success
+}
+
+/// Write all queued readers and commit them as a single table version
+///
+/// The fragments of the readers are written concurrently on the runtime and committed
+/// together, so every reader adds at least one fragment to the new version.
+///
+/// # Safety
+/// - `loader` must be a valid pointer returned from `lancedb_table_bulk_load_new`
+/// - This function consumes the loader pointer; do not use it after calling
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure; nothing is committed on failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_bulk_loader_commit(
+    loader: *mut LanceDBBulkLoader,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if loader.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let loader_box = Box::from_raw(loader);
+    let readers = loader_box.readers.into_inner().unwrap();
+    if readers.is_empty() {
+        return LanceDBError::Success;
+    }
+
+    let table = loader_box.table;
+    let result = block_on(
+        c"bulk_loader_commit",
+        bulk_load(&table, readers, loader_box.config),
+    );
+    table.snapshot.invalidate();
+
+    match result {
+        Ok(_) => LanceDBError::Success,
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
+/// Free a bulk loader without committing it
+///
+/// # Safety
+/// - `loader` must be a valid pointer returned from `lancedb_table_bulk_load_new`
+/// - `loader` must not be used after calling this function
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_bulk_loader_free(loader: *mut LanceDBBulkLoader) {
+    if !loader.is_null() {
+        let _ = Box::from_raw(loader);
+    }
+}
+
 /* ========== TABLE UTILITY OPERATIONS ========== */
 
 /// Get table version
@@ -366,9 +958,89 @@ pub unsafe extern "C" fn lancedb_table_version(table: *const LanceDBTable) -> u6
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
-    runtime.block_on(tbl.version()).unwrap_or(0)
+    block_on(c"table_version", tbl.version()).unwrap_or(0)
+}
+
+/// Check out a read-only handle of the table pinned to a version
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `table_out` must be a valid pointer to receive the pinned table
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - The pinned table must be freed with `lancedb_table_free`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_checkout(
+    table: *const LanceDBTable,
+    version: u64,
+    table_out: *mut *mut LanceDBTable,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if table.is_null() || table_out.is_null() || version == 0 {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    match block_on(c"table_checkout", (*table).checkout(version)) {
+        Ok(pinned) => {
+            *table_out = Box::into_raw(Box::new(pinned));
+            LanceDBError::Success
+        }
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
+/// Get table version and schema from the table's snapshot cache
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `version_out` can be NULL, otherwise it must be a valid pointer to receive the version
+/// - `schema_out` can be NULL, otherwise it must be a valid pointer to receive the Arrow schema
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - The schema must be freed with `lancedb_free_arrow_schema`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_snapshot(
+    table: *const LanceDBTable,
+    max_staleness_ms: i64,
+    version_out: *mut u64,
+    schema_out: *mut *mut arrow_schema::ffi::FFI_ArrowSchema,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if table.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let tbl = &(*table).inner;
+    let cache = &(*table).snapshot;
+    let max_age = cache.max_age(max_staleness_ms);
+    let snapshot = match cache.get(max_age) {
+        (Some(snapshot), _) => snapshot,
+        (None, _) => match block_on(c"table_snapshot", cache.current(tbl, max_age)) {
+            Ok(snapshot) => snapshot,
+            Err(e) => return handle_error(&e, error_message),
+        },
+    };
+
+    if !schema_out.is_null() {
+        match arrow_schema::ffi::FFI_ArrowSchema::try_from(&*snapshot.schema) {
+            Ok(ffi_schema) => *schema_out = Box::into_raw(Box::new(ffi_schema)),
+            Err(_) => {
+                set_unknown_error_message(error_message);
+                return LanceDBError::Unknown;
+            }
+        }
+    }
+    if !version_out.is_null() {
+        *version_out = snapshot.version;
+    }
+    LanceDBError::Success
 }
 
 /// Count rows in table
@@ -385,14 +1057,116 @@ pub unsafe extern "C" fn lancedb_table_count_rows(table: *const LanceDBTable) ->
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
-    match runtime.block_on(tbl.count_rows(None)) {
+    match block_on(c"table_count_rows", tbl.count_rows(None)) {
         Ok(count) => count as u64,
         Err(_) => 0,
     }
 }
 
+/// Count rows in table matching a filter
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `filter` can be NULL to count all rows, or a valid null-terminated C string
+/// - `count_out` must be a valid pointer to receive the row count
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_count_rows_filtered(
+    table: *const LanceDBTable,
+    filter: *const c_char,
+    max_staleness_ms: i64,
+    count_out: *mut u64,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if table.is_null() || count_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    let filter = if filter.is_null() {
+        None
+    } else {
+        let Ok(filter_str) = CStr::from_ptr(filter).to_str() else {
+            set_invalid_argument_message(error_message);
+            return LanceDBError::InvalidArgument;
+        };
+        Some(filter_str.to_string())
+    };
+
+    let tbl = &(*table).inner;
+    let cache = &(*table).snapshot;
+
+    let (cached, generation) = cache.get_count(&filter, cache.max_age(max_staleness_ms));
+    if let Some(count) = cached {
+        *count_out = count;
+        return LanceDBError::Success;
+    }
+
+    let counted_at = Instant::now();
+    match block_on(c"table_count_rows_filtered", tbl.count_rows(filter.clone())) {
+        Ok(count) => {
+            cache.store_count(generation, filter, count as u64, counted_at);
+            *count_out = count as u64;
+            LanceDBError::Success
+        }
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
+/// Approximate number of rows of a table from its manifest
+///
+/// Sums the physical rows of the fragments minus the deletions recorded in the manifest,
+/// without reading deletion or data files. Fragments written by old Lance versions that
+/// lack these statistics fall back to an exact count of the dataset.
+async fn approximate_row_count(table: &LanceDBTable) -> lancedb::error::Result<u64> {
+    let dataset = open_dataset(&table.inner, &table.dataset_options, 0).await?;
+    let mut count = 0u64;
+    for fragment in dataset.fragments().iter() {
+        let deleted = match &fragment.deletion_file {
+            Some(deletion_file) => deletion_file.num_deleted_rows,
+            None => Some(0),
+        };
+        let (Some(physical_rows), Some(deleted)) = (fragment.physical_rows, deleted) else {
+            return Ok(dataset.count_rows(None).await? as u64);
+        };
+        count += physical_rows.saturating_sub(deleted) as u64;
+    }
+    Ok(count)
+}
+
+/// Count rows in table from manifest statistics only
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `count_out` must be a valid pointer to receive the row count
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_count_rows_approx(
+    table: *const LanceDBTable,
+    count_out: *mut u64,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if table.is_null() || count_out.is_null() {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
+
+    match block_on(c"table_count_rows_approx", approximate_row_count(&*table)) {
+        Ok(count) => {
+            *count_out = count;
+            LanceDBError::Success
+        }
+        Err(e) => handle_error(&e, error_message),
+    }
+}
+
 /// Delete rows from table based on predicate
 ///
 /// # Safety
@@ -419,9 +1193,11 @@ pub unsafe extern "C" fn lancedb_table_delete(
     };
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
 
-    match runtime.block_on(tbl.delete(predicate_str)) {
+    let result = block_on(c"table_delete", tbl.delete(predicate_str));
+    (*table).snapshot.invalidate();
+
+    match result {
         Ok(_) => LanceDBError::Success,
         Err(e) => handle_error(&e, error_message),
     }
@@ -452,9 +1228,99 @@ pub unsafe extern "C" fn lancedb_table_nearest_to(
     result_schema: *mut *mut arrow_schema::ffi::FFI_ArrowSchema,
     count_out: *mut usize,
     error_message: *mut *mut c_char,
+) -> LanceDBError {
+    lancedb_table_nearest_to_batch(
+        table,
+        vector,
+        1,
+        dimension,
+        limit,
+        column,
+        result_arrays,
+        result_schema,
+        count_out,
+        error_message,
+    )
+}
+
+/// Vector search for multiple query vectors with full result conversion
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `vectors` must be a valid pointer to a row-major matrix of `num_queries` x `dimension` floats
+/// - `num_queries` must be > 0
+/// - `dimension` must match the actual dimension of the vector column
+/// - `limit` must be > 0 and applies to each query vector
+/// - `result_arrays` must be a valid pointer to receive Arrow C ABI array results
+/// - `result_schema` must be a valid pointer to receive single Arrow C ABI schema
+/// - `count_out` must be a valid pointer to receive the number of result batches
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - When `num_queries` > 1, results carry a `query_index` column identifying the query vector
+/// - Caller must free arrays with `lancedb_free_arrow_arrays` and schema with `lancedb_free_arrow_schema`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_nearest_to_batch(
+    table: *const LanceDBTable,
+    vectors: *const f32,
+    num_queries: usize,
+    dimension: usize,
+    limit: usize,
+    column: *const c_char,
+    result_arrays: *mut *mut *mut arrow_array::ffi::FFI_ArrowArray,
+    result_schema: *mut *mut arrow_schema::ffi::FFI_ArrowSchema,
+    count_out: *mut usize,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    lancedb_table_nearest_to_typed(
+        table,
+        vectors as *const c_void,
+        LanceDBVectorElementType::Float32,
+        num_queries,
+        dimension,
+        limit,
+        column,
+        result_arrays,
+        result_schema,
+        count_out,
+        error_message,
+    )
+}
+
+/// Vector search for query vectors of the given element type with full result conversion
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `vectors` must be a valid pointer to a row-major matrix of `num_queries` x `dimension`
+///   elements of `element_type`
+/// - `num_queries` must be > 0
+/// - `dimension` must match the actual dimension of the vector column (bytes for UInt8)
+/// - `limit` must be > 0 and applies to each query vector
+/// - `result_arrays` must be a valid pointer to receive Arrow C ABI array results
+/// - `result_schema` must be a valid pointer to receive single Arrow C ABI schema
+/// - `count_out` must be a valid pointer to receive the number of result batches
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - When `num_queries` > 1, results carry a `query_index` column identifying the query vector
+/// - Caller must free arrays with `lancedb_free_arrow_arrays` and schema with `lancedb_free_arrow_schema`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_nearest_to_typed(
+    table: *const LanceDBTable,
+    vectors: *const c_void,
+    element_type: LanceDBVectorElementType,
+    num_queries: usize,
+    dimension: usize,
+    limit: usize,
+    column: *const c_char,
+    result_arrays: *mut *mut *mut arrow_array::ffi::FFI_ArrowArray,
+    result_schema: *mut *mut arrow_schema::ffi::FFI_ArrowSchema,
+    count_out: *mut usize,
+    error_message: *mut *mut c_char,
 ) -> LanceDBError {
     if table.is_null()
-        || vector.is_null()
+        || vectors.is_null()
+        || num_queries == 0
         || dimension == 0
         || limit == 0
         || result_arrays.is_null()
@@ -466,9 +1332,7 @@ pub unsafe extern "C" fn lancedb_table_nearest_to(
     }
 
     let tbl = &(*table).inner;
-    let runtime = get_runtime();
-    let vec_slice = std::slice::from_raw_parts(vector, dimension);
-    let vec_data: Vec<f32> = vec_slice.to_vec();
+    let query_vectors = query_vectors_from_raw(vectors, element_type, num_queries, dimension);
 
     let column_name = if column.is_null() {
         None
@@ -482,60 +1346,160 @@ pub unsafe extern "C" fn lancedb_table_nearest_to(
         }
     };
 
-    match runtime.block_on(async {
-        let mut query = tbl.query().limit(limit).nearest_to(vec_data)?;
+    match block_on(c"table_nearest_to", async {
+        let mut query = nearest_to_all(tbl.query().limit(limit), query_vectors)?;
 
         if let Some(col) = column_name {
             query = query.column(col);
         }
 
-        let batches: Vec<RecordBatch> = query.execute().await?.try_collect().await?;
+        let stream = (*table).memory.track_stream(query.execute().await?);
+        let batches: Vec<RecordBatch> = stream.try_collect().await?;
         Ok::<Vec<RecordBatch>, lancedb::error::Error>(batches)
     }) {
-        Ok(batches) => {
-            let count = batches.len();
-            *count_out = count;
+        Ok(batches) => export_batches(
+            batches,
+            result_arrays,
+            result_schema,
+            count_out,
+            error_message,
+        ),
+        Err(e) => handle_error(&e, error_message),
+    }
+}
 
-            if count == 0 {
-                *result_arrays = ptr::null_mut();
-                *result_schema = ptr::null_mut();
-                return LanceDBError::Success;
-            }
+/// Fetch rows by their row IDs
+///
+/// Row IDs are the `_rowid` values returned by queries with row IDs enabled. Rows are
+/// read directly from their fragments, without scanning or filtering the table.
+///
+/// # Safety
+/// - `table` must be a valid pointer returned from `lancedb_connection_open_table`
+/// - `row_ids` must be a valid pointer to `num_row_ids` row IDs
+/// - `columns` can be NULL to fetch all columns, otherwise an array of `num_columns`
+///   valid null-terminated C strings
+/// - `result_arrays` must be a valid pointer to receive Arrow C ABI array results
+/// - `result_schema` must be a valid pointer to receive single Arrow C ABI schema
+/// - `count_out` must be a valid pointer to receive the number of result batches
+/// - `error_message` can be NULL to ignore detailed error messages
+///
+/// # Returns
+/// - Error code indicating success or failure
+/// - Rows are returned in the order of `row_ids`
+/// - Caller must free arrays with `lancedb_free_arrow_arrays` and schema with `lancedb_free_arrow_schema`
+#[no_mangle]
+pub unsafe extern "C" fn lancedb_table_take_row_ids(
+    table: *const LanceDBTable,
+    row_ids: *const u64,
+    num_row_ids: usize,
+    columns: *const *const c_char,
+    num_columns: usize,
+    result_arrays: *mut *mut *mut arrow_array::ffi::FFI_ArrowArray,
+    result_schema: *mut *mut arrow_schema::ffi::FFI_ArrowSchema,
+    count_out: *mut usize,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    if table.is_null()
+        || row_ids.is_null()
+        || num_row_ids == 0
+        || result_arrays.is_null()
+        || result_schema.is_null()
+        || count_out.is_null()
+    {
+        set_invalid_argument_message(error_message);
+        return LanceDBError::InvalidArgument;
+    }
 
-            // Get schema from first batch (all batches have same schema)
-            let schema = batches[0].schema();
-            let ffi_schema = match arrow_schema::ffi::FFI_ArrowSchema::try_from(&*schema) {
-                Ok(schema) => Box::new(schema),
-                Err(_) => {
-                    set_unknown_error_message(error_message);
-                    return LanceDBError::Unknown;
-                }
-            };
-            *result_schema = Box::into_raw(ffi_schema);
-
-            // Allocate array for Arrow C ABI array structures
-            let arrays_ptr =
-                libc::malloc(count * std::mem::size_of::<*mut arrow_array::ffi::FFI_ArrowArray>())
-                    as *mut *mut arrow_array::ffi::FFI_ArrowArray;
-            if arrays_ptr.is_null() {
-                // Clean up schema on allocation failure
-                let _ = Box::from_raw(*result_schema);
-                *result_schema = ptr::null_mut();
-                set_unknown_error_message(error_message);
-                return LanceDBError::Unknown;
-            }
+    let column_names = if columns.is_null() {
+        None
+    } else {
+        let Some(column_names) = on_columns_from_c(columns, num_columns) else {
+            set_invalid_argument_message(error_message);
+            return LanceDBError::InvalidArgument;
+        };
+        Some(column_names)
+    };
 
-            for (i, batch) in batches.into_iter().enumerate() {
-                // Convert RecordBatch to StructArray first, then to FFI_ArrowArray
-                let struct_array: StructArray = batch.clone().into();
-                let array_data: arrow_data::ArrayData = struct_array.into_data();
-                let ffi_array = Box::new(arrow_array::ffi::FFI_ArrowArray::new(&array_data));
-                *arrays_ptr.add(i) = Box::into_raw(ffi_array);
-            }
+    let tbl = &(*table).inner;
+    let options = &(*table).dataset_options;
+    let row_ids = std::slice::from_raw_parts(row_ids, num_row_ids);
+
+    let batch = block_on(c"table_take_row_ids", async {
+        let dataset = open_dataset(tbl, options, 0).await?;
+        let column_names = column_names.unwrap_or_else(|| {
+            dataset
+                .schema()
+                .fields
+                .iter()
+                .map(|field| field.name.clone())
+                .collect()
+        });
+        let projection = ProjectionRequest::from_columns(column_names, dataset.schema());
+        let batch = dataset.take_rows(row_ids, projection).await?;
+        (*table).memory.track(batch)
+    });
+
+    match batch {
+        Ok(batch) => export_batches(
+            vec![batch],
+            result_arrays,
+            result_schema,
+            count_out,
+            error_message,
+        ),
+        Err(e) => handle_error(&e, error_message),
+    }
+}
 
-            *result_arrays = arrays_ptr;
-            LanceDBError::Success
+/// Export collected result batches as Arrow C ABI arrays sharing a single schema
+pub(crate) unsafe fn export_batches(
+    batches: Vec<RecordBatch>,
+    result_arrays: *mut *mut *mut arrow_array::ffi::FFI_ArrowArray,
+    result_schema: *mut *mut arrow_schema::ffi::FFI_ArrowSchema,
+    count_out: *mut usize,
+    error_message: *mut *mut c_char,
+) -> LanceDBError {
+    let count = batches.len();
+    *count_out = count;
+
+    if count == 0 {
+        *result_arrays = ptr::null_mut();
+        *result_schema = ptr::null_mut();
+        return LanceDBError::Success;
+    }
+
+    // Get schema from first batch (all batches have same schema)
+    let schema = batches[0].schema();
+    let ffi_schema = match arrow_schema::ffi::FFI_ArrowSchema::try_from(&*schema) {
+        Ok(schema) => Box::new(schema),
+        Err(err) => {
+            if !error_message.is_null() {
+                let error_str = format!("Failed to convert Arrow schema to C ABI: {err}");
+                if let Ok(c_str) = std::ffi::CString::new(error_str) {
+                    *error_message = c_str.into_raw();
+                }
+            }
+            return LanceDBError::Unknown;
         }
-        Err(e) => handle_error(&e, error_message),
+    };
+    *result_schema = Box::into_raw(ffi_schema);
+
+    // Allocate array for Arrow C ABI array structures
+    let arrays_ptr =
+        libc::malloc(count * std::mem::size_of::<*mut arrow_array::ffi::FFI_ArrowArray>())
+            as *mut *mut arrow_array::ffi::FFI_ArrowArray;
+    if arrays_ptr.is_null() {
+        // Clean up schema on allocation failure
+        let _ = Box::from_raw(*result_schema);
+        *result_schema = ptr::null_mut();
+        set_unknown_error_message(error_message);
+        return LanceDBError::Unknown;
     }
+
+    for (i, batch) in batches.into_iter().enumerate() {
+        *arrays_ptr.add(i) = Box::into_raw(Box::new(batch_to_ffi_array(batch)));
+    }
+
+    *result_arrays = arrays_ptr;
+    LanceDBError::Success
 }
@@ -3,7 +3,14 @@
 
 //! Common types shared across LanceDB C bindings modules
 
-use arrow_array::RecordBatchReader;
+use std::mem;
+use std::os::raw::{c_char, c_void};
+use std::ptr;
+use std::sync::Arc;
+
+use arrow::buffer::{Buffer, ScalarBuffer};
+use arrow_array::{ArrayRef, Float16Array, Float32Array, RecordBatchReader, UInt8Array};
+use arrow_schema::SchemaRef;
 use lancedb::DistanceType;
 
 /// Distance type enum for C API
@@ -27,6 +34,60 @@ impl From<LanceDBDistanceType> for DistanceType {
     }
 }
 
+/// Element type of query vector buffers for C API
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub enum LanceDBVectorElementType {
+    Float32 = 0,
+    Float16 = 1,
+    UInt8 = 2,
+}
+
+impl LanceDBVectorElementType {
+    /// Size of a single element in bytes
+    pub fn byte_width(self) -> usize {
+        match self {
+            Self::Float32 => 4,
+            Self::Float16 => 2,
+            Self::UInt8 => 1,
+        }
+    }
+}
+
+/// Build query vectors from a row-major matrix of `num_queries` x `dimension` elements
+///
+/// The matrix is copied once into a single Arrow buffer and each query vector is a
+/// zero-copy slice of it, so executing the query does not copy the vectors again.
+///
+/// # Safety
+/// - `data` must point to at least `num_queries * dimension` elements of `element_type`
+pub(crate) unsafe fn query_vectors_from_raw(
+    data: *const c_void,
+    element_type: LanceDBVectorElementType,
+    num_queries: usize,
+    dimension: usize,
+) -> Vec<ArrayRef> {
+    let len = num_queries * dimension;
+    let bytes = std::slice::from_raw_parts(data as *const u8, len * element_type.byte_width());
+    let buffer = Buffer::from_slice_ref(bytes);
+
+    let values: ArrayRef = match element_type {
+        LanceDBVectorElementType::Float32 => {
+            Arc::new(Float32Array::new(ScalarBuffer::new(buffer, 0, len), None))
+        }
+        LanceDBVectorElementType::Float16 => {
+            Arc::new(Float16Array::new(ScalarBuffer::new(buffer, 0, len), None))
+        }
+        LanceDBVectorElementType::UInt8 => {
+            Arc::new(UInt8Array::new(ScalarBuffer::new(buffer, 0, len), None))
+        }
+    };
+
+    (0..num_queries)
+        .map(|i| values.slice(i * dimension, dimension))
+        .collect()
+}
+
 /// Opaque handle to Arrow RecordBatchReader for C interop
 #[repr(C)]
 pub struct LanceDBRecordBatchReader {
@@ -39,16 +100,134 @@ impl LanceDBRecordBatchReader {
         Self { inner: reader }
     }
 
+    /// Schema of the batches yielded by the reader
+    pub fn schema(&self) -> SchemaRef {
+        self.inner.schema()
+    }
+
     /// Extract the inner reader (consumes self)
     pub fn into_inner(self) -> Box<dyn RecordBatchReader + Send> {
         self.inner
     }
 }
 
+/// Handling of source rows with duplicate merge keys
+#[repr(C)]
+#[derive(Debug, Copy, Clone, PartialEq, Eq)]
+pub enum LanceDBMergeInsertDedup {
+    None = 0,
+    First = 1,
+    Last = 2,
+}
+
 /// Merge insert configuration
+///
+/// Versioned by `struct_size`: fields beyond the size passed by the caller take their
+/// defaults, so callers built against an older header keep working when fields are added.
+/// A `struct_size` of 0 stands for the first versioned layout, which callers get from
+/// designated initializers written before the field existed.
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
 pub struct LanceDBMergeInsertConfig {
+    pub struct_size: usize, // Size of the struct, set by lancedb_merge_insert_config_init
     pub when_matched_update_all: i32, // Update all columns for matched records (1 = true, 0 = false)
     pub when_not_matched_insert_all: i32, // Insert all new records (1 = true, 0 = false)
+    pub when_matched_update_filter: *const c_char, // Only update matched records satisfying this condition (NULL = all)
+    pub when_not_matched_by_source_delete: i32, // Delete target records missing from the source (1 = true, 0 = false)
+    pub when_not_matched_by_source_delete_filter: *const c_char, // Only delete records satisfying this condition (NULL = all)
+    pub source_dedup: LanceDBMergeInsertDedup, // Handling of source records with duplicate keys
+}
+
+impl Default for LanceDBMergeInsertConfig {
+    // Default upsert behavior
+    fn default() -> Self {
+        Self {
+            struct_size: mem::size_of::<Self>(),
+            when_matched_update_all: 1,
+            when_not_matched_insert_all: 1,
+            when_matched_update_filter: ptr::null(),
+            when_not_matched_by_source_delete: 0,
+            when_not_matched_by_source_delete_filter: ptr::null(),
+            source_dedup: LanceDBMergeInsertDedup::None,
+        }
+    }
+}
+
+impl LanceDBMergeInsertConfig {
+    /// Copy the fields known to both the caller and this library
+    ///
+    /// Returns None if the caller's struct is too small to hold `struct_size`.
+    pub(crate) unsafe fn from_c(config: *const Self) -> Option<Self> {
+        // Size of the first versioned layout, ending with source_dedup
+        const FIRST_VERSION_SIZE: usize = mem::offset_of!(LanceDBMergeInsertConfig, source_dedup)
+            + mem::size_of::<LanceDBMergeInsertDedup>();
+
+        let mut out = Self::default();
+        if config.is_null() {
+            return Some(out);
+        }
+
+        let size = match (*config).struct_size {
+            0 => FIRST_VERSION_SIZE,
+            size => size,
+        };
+        if size < mem::size_of::<usize>() {
+            return None;
+        }
+        ptr::copy_nonoverlapping(
+            config as *const u8,
+            &mut out as *mut Self as *mut u8,
+            size.min(mem::size_of::<Self>()),
+        );
+        out.struct_size = mem::size_of::<Self>();
+        Some(out)
+    }
+}
+
+/// Write configuration controlling the layout of written data files
+///
+/// Versioned by `struct_size`: fields beyond the size passed by the caller take their
+/// defaults, so callers built against an older header keep working when fields are added.
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct LanceDBWriteConfig {
+    pub struct_size: usize, // Size of the struct, set by lancedb_write_config_init
+    pub max_rows_per_file: usize, // Maximum rows per data file (0 = default)
+    pub max_rows_per_group: usize, // Maximum rows per row group (0 = default)
+    pub max_bytes_per_file: usize, // Soft limit of bytes per data file (0 = default)
+}
+
+impl Default for LanceDBWriteConfig {
+    fn default() -> Self {
+        Self {
+            struct_size: mem::size_of::<Self>(),
+            max_rows_per_file: 0,
+            max_rows_per_group: 0,
+            max_bytes_per_file: 0,
+        }
+    }
+}
+
+impl LanceDBWriteConfig {
+    /// Copy the fields known to both the caller and this library
+    ///
+    /// Returns None if the caller's struct is too small to hold `struct_size`.
+    pub(crate) unsafe fn from_c(config: *const Self) -> Option<Self> {
+        let mut out = Self::default();
+        if config.is_null() {
+            return Some(out);
+        }
+
+        let size = (*config).struct_size;
+        if size < mem::size_of::<usize>() {
+            return None;
+        }
+        ptr::copy_nonoverlapping(
+            config as *const u8,
+            &mut out as *mut Self as *mut u8,
+            size.min(mem::size_of::<Self>()),
+        );
+        out.struct_size = mem::size_of::<Self>();
+        Some(out)
+    }
 }
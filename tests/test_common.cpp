@@ -147,3 +147,15 @@ LanceDBRecordBatchReader* create_reader_from_batch(const std::shared_ptr<arrow::
   return reader;
 }
 
+
+LanceDBRecordBatchReader* create_reader_from_batches(const std::vector<std::shared_ptr<arrow::RecordBatch>>& batches) {
+  auto batch_reader = arrow::RecordBatchReader::Make(batches, create_test_schema());
+  REQUIRE(batch_reader.ok());
+
+  struct ArrowArrayStream c_stream;
+  REQUIRE(arrow::ExportRecordBatchReader(*batch_reader, &c_stream).ok());
+
+  // The stream is consumed by the function
+  return lancedb_record_batch_reader_from_arrow_stream(
+      reinterpret_cast<FFI_ArrowArrayStream*>(&c_stream));
+}
@@ -87,3 +87,6 @@ std::shared_ptr<arrow::RecordBatch> create_test_record_batch(int num_rows, int s
 // Helper function to create RecordBatchReader from RecordBatch
 LanceDBRecordBatchReader* create_reader_from_batch(const std::shared_ptr<arrow::RecordBatch>& batch);
 
+// Helper function to create a streaming RecordBatchReader from multiple RecordBatches
+LanceDBRecordBatchReader* create_reader_from_batches(const std::vector<std::shared_ptr<arrow::RecordBatch>>& batches);
+
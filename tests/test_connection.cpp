@@ -4,6 +4,8 @@
  */
 
 #include "test_common.h"
+#include <algorithm>
+#include <mutex>
 #include <set>
 
 static const char* NON_UTF8 = "\x80\xFF\xFE\xAB";
@@ -17,6 +19,136 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Connection", "[connection]") {
   }
 }
 
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Runtime", "[connection]") {
+  SECTION("Init runtime after it is in use should fail") {
+    // The fixture connection already started the default runtime
+    LanceDBRuntimeConfig config = {
+      .worker_threads = 2,
+      .max_blocking_threads = -1,
+      .thread_name_prefix = "lancedb-test",
+      .current_thread = 0,
+      .on_thread_start = nullptr,
+      .user_data = nullptr
+    };
+    char* error_message = nullptr;
+    REQUIRE(lancedb_runtime_init(&config, &error_message) == LANCEDB_RUNTIME);
+    REQUIRE(error_message != nullptr);
+    lancedb_free_string(error_message);
+  }
+
+  SECTION("NULL runtime config should fail") {
+    REQUIRE(lancedb_runtime_init(nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
+}
+
+struct SpanCollector {
+  std::mutex mutex;
+  std::vector<std::string> names;
+  int errors = 0;
+};
+
+static void collect_span(const LanceDBSpan* span, void* user_data) {
+  auto* collector = static_cast<SpanCollector*>(user_data);
+  std::lock_guard<std::mutex> lock(collector->mutex);
+  collector->names.emplace_back(span->name);
+  collector->errors += span->error;
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Metrics", "[connection]") {
+  // Metrics are process-wide, start from a clean slate
+  lancedb_metrics_reset();
+
+  SECTION("Operations are counted and timed") {
+    LanceDBTable* table = create_table_with_data("metrics_table", 10, 0);
+    REQUIRE(lancedb_table_count_rows(table) == 10);
+    REQUIRE(lancedb_table_count_rows(table) == 10);
+    REQUIRE(lancedb_connection_open_table(db, "no_such_table") == nullptr);
+
+    LanceDBOperationMetrics metrics;
+    REQUIRE(lancedb_metrics_operation("table_count_rows", &metrics, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(metrics.calls == 2);
+    REQUIRE(metrics.errors == 0);
+    REQUIRE(metrics.max_nanos > 0);
+    REQUIRE(metrics.total_nanos >= metrics.max_nanos);
+    unsigned long long bucketed = 0;
+    for (int i = 0; i < LANCEDB_LATENCY_BUCKETS; i++) {
+      bucketed += metrics.latency_buckets[i];
+    }
+    REQUIRE(bucketed == metrics.calls);
+
+    REQUIRE(lancedb_metrics_operation("connection_open_table", &metrics, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(metrics.calls == 1);
+    REQUIRE(metrics.errors == 1);
+
+    REQUIRE(lancedb_metrics_operation("never_called", &metrics, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(metrics.calls == 0);
+
+    lancedb_metrics_reset();
+    REQUIRE(lancedb_metrics_operation("table_count_rows", &metrics, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(metrics.calls == 0);
+    lancedb_table_free(table);
+  }
+
+  SECTION("Exported batches are counted") {
+    LanceDBTable* table = create_table_with_data("metrics_table", 10, 0);
+    LanceDBQueryResult* query_result = lancedb_query_execute(lancedb_query_new(table));
+    REQUIRE(query_result != nullptr);
+
+    FFI_ArrowArray* batch = nullptr;
+    int batches = 0;
+    while (lancedb_query_result_next_batch(query_result, &batch, nullptr) == LANCEDB_SUCCESS && batch != nullptr) {
+      batches++;
+      lancedb_free_arrow_array(batch);
+    }
+    lancedb_query_result_free(query_result);
+    REQUIRE(batches > 0);
+
+    LanceDBExportMetrics exported;
+    lancedb_metrics_exported(&exported);
+    REQUIRE(exported.batches == static_cast<unsigned long long>(batches));
+    REQUIRE(exported.bytes > 0);
+    lancedb_table_free(table);
+  }
+
+  SECTION("Span callback receives finished operations") {
+    SpanCollector collector;
+    lancedb_metrics_set_span_callback(collect_span, &collector);
+    LanceDBTable* table = create_table_with_data("metrics_table", 10, 0);
+    REQUIRE(lancedb_table_count_rows(table) == 10);
+    REQUIRE(lancedb_connection_open_table(db, "no_such_table") == nullptr);
+    lancedb_metrics_set_span_callback(nullptr, nullptr);
+    REQUIRE(lancedb_table_count_rows(table) == 10);
+
+    std::lock_guard<std::mutex> lock(collector.mutex);
+    REQUIRE(std::count(collector.names.begin(), collector.names.end(), "table_count_rows") == 1);
+    REQUIRE(std::count(collector.names.begin(), collector.names.end(), "connection_open_table") == 1);
+    REQUIRE(collector.errors == 1);
+    lancedb_table_free(table);
+  }
+
+  SECTION("JSON report") {
+    LanceDBTable* table = create_table_with_data("metrics_table", 10, 0);
+    REQUIRE(lancedb_table_count_rows(table) == 10);
+
+    char* report = nullptr;
+    REQUIRE(lancedb_metrics_report(&report, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(report != nullptr);
+    std::string json(report);
+    lancedb_free_string(report);
+    REQUIRE(json.rfind("{\"operations\":{", 0) == 0);
+    REQUIRE(json.find("\"table_count_rows\":{\"calls\":1,\"errors\":0") != std::string::npos);
+    REQUIRE(json.find("\"exported\":{") != std::string::npos);
+    lancedb_table_free(table);
+  }
+
+  SECTION("Invalid arguments") {
+    LanceDBOperationMetrics metrics;
+    REQUIRE(lancedb_metrics_operation(nullptr, &metrics, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_metrics_operation("table_add", nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_metrics_report(nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
+}
+
 TEST_CASE_METHOD(BaseFixture, "LanceDB Connection Builder", "[connection]") {
   SECTION("Use connection builder to set options") {
     LanceDBConnectBuilder* builder = lancedb_connect(uri.c_str());
@@ -27,6 +159,247 @@ TEST_CASE_METHOD(BaseFixture, "LanceDB Connection Builder", "[connection]") {
     REQUIRE(db != nullptr);
     lancedb_connection_free(db);
   }
+  SECTION("Use connection builder to size caches and set read consistency") {
+    LanceDBConnectBuilder* builder = lancedb_connect(uri.c_str());
+    REQUIRE(builder != nullptr);
+    builder = lancedb_connect_builder_index_cache_size(builder, 64ull * 1024 * 1024 * 1024);
+    REQUIRE(builder != nullptr);
+    builder = lancedb_connect_builder_metadata_cache_size(builder, 256 * 1024 * 1024);
+    REQUIRE(builder != nullptr);
+    builder = lancedb_connect_builder_read_consistency_interval(builder, 0);
+    REQUIRE(builder != nullptr);
+    LanceDBConnection* db = lancedb_connect_builder_execute(builder);
+    REQUIRE(db != nullptr);
+
+    struct ArrowSchema c_schema;
+    REQUIRE(arrow::ExportSchema(*create_test_schema(), &c_schema).ok());
+    LanceDBTable* table = nullptr;
+    REQUIRE(lancedb_table_create(db, "consistency_table", reinterpret_cast<FFI_ArrowSchema*>(&c_schema),
+        create_reader_from_batch(create_test_record_batch(10, 0)), &table, nullptr) == LANCEDB_SUCCESS);
+    if (c_schema.release) {
+      c_schema.release(&c_schema);
+    }
+
+    // Writes through another connection are visible on the next read
+    LanceDBConnection* writer = lancedb_connect_builder_execute(lancedb_connect(uri.c_str()));
+    REQUIRE(writer != nullptr);
+    LanceDBTable* writer_table = lancedb_connection_open_table(writer, "consistency_table");
+    REQUIRE(writer_table != nullptr);
+    REQUIRE(lancedb_table_add(writer_table, create_reader_from_batch(create_test_record_batch(5, 10)), nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows(table) == 15);
+
+    lancedb_table_free(writer_table);
+    lancedb_connection_free(writer);
+    lancedb_table_free(table);
+    lancedb_connection_free(db);
+  }
+  SECTION("Use connection builder to cache table handles") {
+    LanceDBConnectBuilder* builder = lancedb_connect(uri.c_str());
+    builder = lancedb_connect_builder_table_cache_size(builder, 1);
+    REQUIRE(builder != nullptr);
+    LanceDBConnection* db = lancedb_connect_builder_execute(builder);
+    REQUIRE(db != nullptr);
+
+    for (const char* name : {"cached_a", "cached_b"}) {
+      struct ArrowSchema c_schema;
+      REQUIRE(arrow::ExportSchema(*create_test_schema(), &c_schema).ok());
+      LanceDBTable* table = nullptr;
+      REQUIRE(lancedb_table_create(db, name, reinterpret_cast<FFI_ArrowSchema*>(&c_schema),
+          nullptr, &table, nullptr) == LANCEDB_SUCCESS);
+      lancedb_table_free(table);
+      if (c_schema.release) {
+        c_schema.release(&c_schema);
+      }
+    }
+
+    // "cached_b" was created last and is still cached, "cached_a" was evicted
+    lancedb_metrics_reset();
+    LanceDBTable* b1 = lancedb_connection_open_table(db, "cached_b");
+    LanceDBTable* b2 = lancedb_connection_open_table(db, "cached_b");
+    REQUIRE(b1 != nullptr);
+    REQUIRE(b2 != nullptr);
+    LanceDBOperationMetrics metrics;
+    REQUIRE(lancedb_metrics_operation("connection_open_table", &metrics, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(metrics.calls == 0);
+
+    LanceDBTable* a = lancedb_connection_open_table(db, "cached_a");
+    REQUIRE(a != nullptr);
+    REQUIRE(lancedb_metrics_operation("connection_open_table", &metrics, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(metrics.calls == 1);
+
+    // Handles of a cached table share their state
+    REQUIRE(lancedb_table_add(b1, create_reader_from_batch(create_test_record_batch(5, 0)), nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows(b2) == 5);
+
+    // Dropping a table evicts it
+    REQUIRE(lancedb_connection_drop_table(db, "cached_a", nullptr, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_connection_open_table(db, "cached_a") == nullptr);
+
+    lancedb_table_free(a);
+    lancedb_table_free(b2);
+    lancedb_table_free(b1);
+    lancedb_connection_free(db);
+  }
+  SECTION("Use connection builder to tune object stores") {
+    const std::string cache_path = uri + "_disk_cache";
+    LanceDBObjectStoreConfig config;
+    lancedb_object_store_config_init(&config);
+    REQUIRE(config.struct_size == sizeof(LanceDBObjectStoreConfig));
+    config.max_concurrent_requests = 16;
+    config.block_size = 1024 * 1024;
+    config.request_timeout_ms = 60000;
+    config.max_retries = 3;
+    config.retry_timeout_ms = 1500;
+    config.disk_cache_path = cache_path.c_str();
+    config.disk_cache_bytes = 64 * 1024 * 1024;
+
+    LanceDBConnectBuilder* builder = lancedb_connect_builder_object_store_config(lancedb_connect(uri.c_str()), &config);
+    REQUIRE(builder != nullptr);
+    LanceDBConnection* db = lancedb_connect_builder_execute(builder);
+    REQUIRE(db != nullptr);
+
+    struct ArrowSchema c_schema;
+    REQUIRE(arrow::ExportSchema(*create_test_schema(), &c_schema).ok());
+    LanceDBTable* table = nullptr;
+    REQUIRE(lancedb_table_create(db, "tuned_table", reinterpret_cast<FFI_ArrowSchema*>(&c_schema),
+        create_reader_from_batch(create_test_record_batch(10, 0)), &table, nullptr) == LANCEDB_SUCCESS);
+    if (c_schema.release) {
+      c_schema.release(&c_schema);
+    }
+    REQUIRE(lancedb_table_count_rows(table) == 10);
+
+    lancedb_table_free(table);
+    lancedb_connection_free(db);
+
+    // Defaults are used for a NULL config
+    builder = lancedb_connect_builder_object_store_config(lancedb_connect(uri.c_str()), nullptr);
+    REQUIRE(builder != nullptr);
+    lancedb_connect_builder_free(builder);
+  }
+  SECTION("Use connection builder to limit memory") {
+    LanceDBConnectBuilder* builder = lancedb_connect_builder_memory_limit(lancedb_connect(uri.c_str()), 64 * 1024 * 1024);
+    REQUIRE(builder != nullptr);
+    LanceDBConnection* db = lancedb_connect_builder_execute(builder);
+    REQUIRE(db != nullptr);
+
+    LanceDBMemoryStats stats;
+    REQUIRE(lancedb_connection_memory_stats(db, &stats, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(stats.current_bytes == 0);
+    REQUIRE(stats.limit_bytes == 64 * 1024 * 1024);
+
+    struct ArrowSchema c_schema;
+    REQUIRE(arrow::ExportSchema(*create_test_schema(), &c_schema).ok());
+    LanceDBTable* table = nullptr;
+    REQUIRE(lancedb_table_create(db, "memory_table", reinterpret_cast<FFI_ArrowSchema*>(&c_schema),
+        create_reader_from_batch(create_test_record_batch(100, 0)), &table, nullptr) == LANCEDB_SUCCESS);
+    if (c_schema.release) {
+      c_schema.release(&c_schema);
+    }
+    REQUIRE(lancedb_connection_memory_stats(db, &stats, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(stats.peak_bytes > 0);
+
+    // Exported results are charged until the caller frees them
+    LanceDBQueryResult* result = lancedb_query_execute(lancedb_query_new(table));
+    REQUIRE(result != nullptr);
+    FFI_ArrowArray** arrays = nullptr;
+    FFI_ArrowSchema* schema = nullptr;
+    size_t count = 0;
+    REQUIRE(lancedb_query_result_to_arrow(result, &arrays, &schema, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_connection_memory_stats(db, &stats, nullptr) == LANCEDB_SUCCESS);
+    const size_t held = stats.current_bytes;
+    REQUIRE(held > 0);
+    lancedb_free_arrow_arrays(arrays, count);
+    lancedb_free_arrow_schema(schema);
+    REQUIRE(lancedb_connection_memory_stats(db, &stats, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(stats.current_bytes < held);
+    REQUIRE(stats.peak_bytes >= held);
+
+    lancedb_table_free(table);
+    lancedb_connection_free(db);
+
+    // Slices of one batch are charged for their rows, not for the shared buffers, which
+    // every slice would otherwise charge in full
+    const size_t sliced_limit = 256 * 1024;
+    db = lancedb_connect_builder_execute(lancedb_connect_builder_memory_limit(lancedb_connect(uri.c_str()), sliced_limit));
+    REQUIRE(db != nullptr);
+    table = lancedb_connection_open_table(db, "memory_table");
+    REQUIRE(table != nullptr);
+    auto parent = create_test_record_batch(2000, 100);
+    std::vector<std::shared_ptr<arrow::RecordBatch>> slices;
+    for (int64_t offset = 0; offset < parent->num_rows(); offset += 100) {
+      slices.push_back(parent->Slice(offset, 100));
+    }
+    REQUIRE(lancedb_table_add(table, create_reader_from_batches(slices), nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows(table) == 2100);
+    REQUIRE(lancedb_connection_memory_stats(db, &stats, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(stats.peak_bytes > 0);
+    REQUIRE(stats.peak_bytes <= sliced_limit);
+
+    lancedb_table_free(table);
+    lancedb_connection_free(db);
+
+    // Batches above the limit fail their operation
+    db = lancedb_connect_builder_execute(lancedb_connect_builder_memory_limit(lancedb_connect(uri.c_str()), 1024));
+    REQUIRE(db != nullptr);
+    table = lancedb_connection_open_table(db, "memory_table");
+    REQUIRE(table != nullptr);
+    char* error_message = nullptr;
+    REQUIRE(lancedb_table_add(table, create_reader_from_batch(create_test_record_batch(100, 100)), &error_message) != LANCEDB_SUCCESS);
+    REQUIRE(error_message != nullptr);
+    lancedb_free_string(error_message);
+    REQUIRE(lancedb_table_count_rows(table) == 2100);
+
+    result = lancedb_query_execute(lancedb_query_new(table));
+    REQUIRE(result != nullptr);
+    REQUIRE(lancedb_query_result_to_arrow(result, &arrays, &schema, &count, nullptr) != LANCEDB_SUCCESS);
+
+    lancedb_table_free(table);
+    lancedb_connection_free(db);
+  }
+  SECTION("Invalid object store config should fail") {
+    LanceDBObjectStoreConfig config;
+    lancedb_object_store_config_init(&config);
+    config.struct_size = 0;
+    REQUIRE(lancedb_connect_builder_object_store_config(lancedb_connect(uri.c_str()), &config) == nullptr);
+
+    lancedb_object_store_config_init(&config);
+    config.disk_cache_path = NON_UTF8;
+    config.disk_cache_bytes = 1024;
+    REQUIRE(lancedb_connect_builder_object_store_config(lancedb_connect(uri.c_str()), &config) == nullptr);
+    REQUIRE(lancedb_connect_builder_object_store_config(nullptr, &config) == nullptr);
+  }
+  SECTION("Failing connection reports the reason") {
+    LanceDBObjectStoreConfig config;
+    lancedb_object_store_config_init(&config);
+    config.disk_cache_path = "/dev/null";
+    config.disk_cache_bytes = 1024;
+    LanceDBConnectBuilder* builder = lancedb_connect_builder_object_store_config(lancedb_connect(uri.c_str()), &config);
+    REQUIRE(builder != nullptr);
+
+    // The cache directory cannot be created below a file
+    LanceDBConnection* failed = nullptr;
+    char* error_message = nullptr;
+    REQUIRE(lancedb_connect_builder_try_execute(builder, &failed, &error_message) != LANCEDB_SUCCESS);
+    REQUIRE(failed == nullptr);
+    REQUIRE(error_message != nullptr);
+    lancedb_free_string(error_message);
+
+    LanceDBConnection* connected = nullptr;
+    REQUIRE(lancedb_connect_builder_try_execute(lancedb_connect(uri.c_str()), &connected, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(connected != nullptr);
+    lancedb_connection_free(connected);
+    REQUIRE(lancedb_connect_builder_try_execute(nullptr, &connected, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
+  SECTION("NULL connection builder cache options should fail") {
+    REQUIRE(lancedb_connect_builder_index_cache_size(nullptr, 1024) == nullptr);
+    REQUIRE(lancedb_connect_builder_metadata_cache_size(nullptr, 1024) == nullptr);
+    REQUIRE(lancedb_connect_builder_read_consistency_interval(nullptr, 0) == nullptr);
+    REQUIRE(lancedb_connect_builder_table_cache_size(nullptr, 16) == nullptr);
+    REQUIRE(lancedb_connect_builder_memory_limit(nullptr, 1024) == nullptr);
+
+    LanceDBMemoryStats stats;
+    REQUIRE(lancedb_connection_memory_stats(nullptr, &stats, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
   SECTION("Free connection builder") {
     LanceDBConnectBuilder* builder = lancedb_connect(uri.c_str());
     REQUIRE(builder != nullptr);
@@ -0,0 +1,140 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ * SPDX-FileCopyrightText: Copyright The LanceDB Authors
+ */
+
+#include "test_common.h"
+#include "lancedb.hpp"
+#include <future>
+#include <optional>
+#include <thread>
+#include <type_traits>
+
+static_assert(!std::is_copy_constructible_v<lancedb::Connection>);
+static_assert(!std::is_copy_constructible_v<lancedb::Table>);
+static_assert(!std::is_copy_constructible_v<lancedb::Query>);
+static_assert(std::is_nothrow_move_constructible_v<lancedb::Table>);
+static_assert(std::is_nothrow_move_constructible_v<lancedb::VectorQuery>);
+
+// Eagerly started coroutine without a result
+struct DetachedTask {
+  struct promise_type {
+    DetachedTask get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+// Executor resuming the coroutine on a new thread, joined by the test
+struct ThreadExecutor {
+  std::optional<std::thread>* thread;
+
+  void operator()(std::coroutine_handle<> handle) const {
+    thread->emplace([handle]() { handle.resume(); });
+  }
+};
+
+static DetachedTask count_rows_async(const lancedb::Table& table, std::optional<std::thread>& thread,
+                                     std::promise<int64_t>& rows) {
+  try {
+    auto reader = co_await table.query().where("key < 'key_5'").execute_async(ThreadExecutor{&thread});
+    auto result_table = reader->ToTable();
+    rows.set_value(result_table.ok() ? (*result_table)->num_rows() : -1);
+  } catch (...) {
+    rows.set_exception(std::current_exception());
+  }
+}
+
+// Same with the default executor, which must move the coroutine off the runtime thread
+static DetachedTask count_all_rows_async(const lancedb::Table& table, std::promise<int64_t>& rows) {
+  try {
+    auto reader = co_await table.query().execute_async();
+    auto result_table = reader->ToTable();
+    rows.set_value(result_table.ok() ? (*result_table)->num_rows() : -1);
+  } catch (...) {
+    rows.set_exception(std::current_exception());
+  }
+}
+
+TEST_CASE_METHOD(BaseFixture, "LanceDB C++ wrapper", "[cpp]") {
+  constexpr int total_rows = 100;
+  auto db = lancedb::Connection::connect(uri.c_str());
+
+  auto batch_reader = arrow::RecordBatchReader::Make({create_test_record_batch(total_rows, 0)}, create_test_schema());
+  REQUIRE(batch_reader.ok());
+  lancedb::Table table = db.create_table("cpp_test", *create_test_schema(), *batch_reader);
+
+  SECTION("Table and connection") {
+    REQUIRE(table.count_rows() == total_rows);
+    REQUIRE(db.table_names() == std::vector<std::string>{"cpp_test"});
+
+    // Handles can be moved but not copied
+    lancedb::Table opened = db.open_table("cpp_test");
+    lancedb::Table moved = std::move(opened);
+    REQUIRE(moved.get() != nullptr);
+    REQUIRE(opened.get() == nullptr);
+    REQUIRE(moved.count_rows() == total_rows);
+
+    auto more = arrow::RecordBatchReader::Make({create_test_record_batch(10, total_rows)}, create_test_schema());
+    REQUIRE(more.ok());
+    const auto version = moved.version();
+    moved.add(*more);
+    REQUIRE(table.count_rows() == total_rows + 10);
+
+    lancedb::Table pinned = table.checkout(version);
+    REQUIRE(pinned.version() == version);
+    REQUIRE(pinned.count_rows() == total_rows);
+  }
+
+  SECTION("Query results are imported as record batch readers") {
+    auto reader = table.query().where("key = 'key_42'").select({"key"}).execute();
+    REQUIRE(reader->schema()->num_fields() == 1);
+    auto result_table = reader->ToTable();
+    REQUIRE(result_table.ok());
+    REQUIRE((*result_table)->num_rows() == 1);
+    auto key_array = std::static_pointer_cast<arrow::StringArray>((*result_table)->column(0)->chunk(0));
+    REQUIRE(key_array->GetString(0) == "key_42");
+  }
+
+  SECTION("Vector search with a span") {
+    std::vector<float> query_vector(TEST_SCHEMA_DIMENSIONS, 0.0f);
+    auto reader = table.search(query_vector).limit(5).with_row_id().execute();
+    REQUIRE(reader->schema()->GetFieldByName("_distance") != nullptr);
+    REQUIRE(reader->schema()->GetFieldByName("_rowid") != nullptr);
+    auto result_table = reader->ToTable();
+    REQUIRE(result_table.ok());
+    REQUIRE((*result_table)->num_rows() == 5);
+  }
+
+  SECTION("Awaiting an asynchronous query") {
+    std::optional<std::thread> thread;
+    std::promise<int64_t> rows;
+    auto rows_future = rows.get_future();
+    count_rows_async(table, thread, rows);
+    // key_0 to key_4 sort before key_5
+    REQUIRE(rows_future.get() == 5 + 40);
+    if (thread) {
+      thread->join();
+    }
+
+    std::promise<int64_t> all_rows;
+    auto all_rows_future = all_rows.get_future();
+    count_all_rows_async(table, all_rows);
+    REQUIRE(all_rows_future.get() == total_rows);
+  }
+
+  SECTION("Failures throw lancedb::Error") {
+    try {
+      db.open_table("missing_table");
+      FAIL("open_table should throw");
+    } catch (const lancedb::Error& e) {
+      REQUIRE(e.code() == LANCEDB_TABLE_NOT_FOUND);
+    }
+
+    std::vector<float> wrong_dimension(TEST_SCHEMA_DIMENSIONS + 1, 0.0f);
+    REQUIRE_THROWS_AS(table.search(wrong_dimension).limit(3).execute(), lancedb::Error);
+    REQUIRE_THROWS_AS(db.create_table("cpp_test", *create_test_schema()), lancedb::Error);
+  }
+}
@@ -290,3 +290,135 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Scalar Index List and Drop", "[index]"
   }
 }
 
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Scalar Index Kinds", "[index]") {
+  constexpr int row_num = 200;
+
+  // Table with a low-cardinality tag column and a list-typed labels column
+  auto schema = arrow::schema({
+      arrow::field("key", arrow::utf8()),
+      arrow::field("data", arrow::fixed_size_list(arrow::float32(), TEST_SCHEMA_DIMENSIONS)),
+      arrow::field("tag", arrow::utf8()),
+      arrow::field("labels", arrow::list(arrow::utf8()))});
+
+  auto base = create_test_record_batch(row_num, 0);
+  arrow::StringBuilder tag_builder;
+  auto label_builder = std::make_shared<arrow::StringBuilder>();
+  arrow::ListBuilder labels_builder(arrow::default_memory_pool(), label_builder);
+  for (int i = 0; i < row_num; i++) {
+    REQUIRE(tag_builder.Append("tenant_" + std::to_string(i % 4)).ok());
+    REQUIRE(labels_builder.Append().ok());
+    REQUIRE(label_builder->Append(i % 2 == 0 ? "even" : "odd").ok());
+    if (i % 10 == 0) {
+      REQUIRE(label_builder->Append("tenth").ok());
+    }
+  }
+  std::shared_ptr<arrow::Array> tag_array, labels_array;
+  REQUIRE(tag_builder.Finish(&tag_array).ok());
+  REQUIRE(labels_builder.Finish(&labels_array).ok());
+  auto batch = arrow::RecordBatch::Make(
+      schema, row_num, {base->column(0), base->column(1), tag_array, labels_array});
+
+  struct ArrowSchema c_schema;
+  REQUIRE(arrow::ExportSchema(*schema, &c_schema).ok());
+  LanceDBTable* table = nullptr;
+  REQUIRE(lancedb_table_create(db, "scalar_index_kinds_test", reinterpret_cast<FFI_ArrowSchema*>(&c_schema),
+                               create_reader_from_batch(batch), &table, nullptr) == LANCEDB_SUCCESS);
+  if (c_schema.release) {
+    c_schema.release(&c_schema);
+  }
+
+  LanceDBScalarIndexConfig config = {
+    .replace = 1,
+    .force_update_statistics = 0
+  };
+  auto create_index = [&](const char* column, LanceDBIndexType index_type) {
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_create_scalar_index(table, &column, 1, index_type, &config, &error_message);
+    if (error_message) {
+      INFO("Error creating index: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+  };
+  auto index_type_of = [&](const char* index_name) {
+    LanceDBIndexStats stats;
+    REQUIRE(lancedb_table_index_stats(table, index_name, &stats, nullptr) == LANCEDB_SUCCESS);
+    return stats.index_type;
+  };
+  auto plan_of = [](LanceDBError result, char* plan) {
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(plan != nullptr);
+    std::string plan_str(plan);
+    lancedb_free_string(plan);
+    return plan_str;
+  };
+  auto count_rows = [](LanceDBQuery* query) {
+    FFI_ArrowArray** result_arrays = nullptr;
+    FFI_ArrowSchema* result_schema = nullptr;
+    size_t count = 0;
+    REQUIRE(lancedb_query_result_to_arrow(
+        lancedb_query_execute(query), &result_arrays, &result_schema, &count, nullptr) == LANCEDB_SUCCESS);
+    size_t sum_rows = 0;
+    for (size_t i = 0; i < count; i++) {
+      sum_rows += reinterpret_cast<ArrowArray*>(result_arrays[i])->length;
+    }
+    lancedb_free_arrow_arrays(result_arrays, count);
+    lancedb_free_arrow_schema(result_schema);
+    return sum_rows;
+  };
+
+  SECTION("Bitmap index answers equality filters") {
+    create_index("tag", LANCEDB_INDEX_BITMAP);
+    REQUIRE(index_type_of("tag_idx") == LANCEDB_INDEX_BITMAP);
+
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_query_where_filter(query, "tag = 'tenant_1'", nullptr) == LANCEDB_SUCCESS);
+    char* plan = nullptr;
+    REQUIRE(plan_of(lancedb_query_explain_plan(query, 1, &plan, nullptr), plan).find("ScalarIndexQuery") != std::string::npos);
+    REQUIRE(count_rows(query) == row_num / 4);
+
+    std::vector<float> query_vector(TEST_SCHEMA_DIMENSIONS, 0.0f);
+    LanceDBVectorQuery* vector_query = lancedb_vector_query_new(table, query_vector.data(), TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(vector_query != nullptr);
+    REQUIRE(lancedb_vector_query_where_filter(vector_query, "tag IN ('tenant_1', 'tenant_2')", nullptr) == LANCEDB_SUCCESS);
+    plan = nullptr;
+    REQUIRE(plan_of(lancedb_vector_query_explain_plan(vector_query, 1, &plan, nullptr), plan).find("ScalarIndexQuery") != std::string::npos);
+    lancedb_vector_query_free(vector_query);
+  }
+
+  SECTION("LabelList index answers list filters") {
+    create_index("labels", LANCEDB_INDEX_LABELLIST);
+    REQUIRE(index_type_of("labels_idx") == LANCEDB_INDEX_LABELLIST);
+
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_query_where_filter(query, "array_has_any(labels, ['tenth'])", nullptr) == LANCEDB_SUCCESS);
+    char* plan = nullptr;
+    REQUIRE(plan_of(lancedb_query_explain_plan(query, 1, &plan, nullptr), plan).find("ScalarIndexQuery") != std::string::npos);
+    REQUIRE(count_rows(query) == row_num / 10);
+  }
+
+  SECTION("Auto picks a BTree for scalar columns") {
+    create_index("key", LANCEDB_INDEX_AUTO);
+    REQUIRE(index_type_of("key_idx") == LANCEDB_INDEX_BTREE);
+  }
+
+  SECTION("Filters without an index are not answered by one") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_query_where_filter(query, "tag = 'tenant_1'", nullptr) == LANCEDB_SUCCESS);
+    char* plan = nullptr;
+    REQUIRE(plan_of(lancedb_query_explain_plan(query, 1, &plan, nullptr), plan).find("ScalarIndexQuery") == std::string::npos);
+    lancedb_query_free(query);
+  }
+
+  SECTION("Vector index kinds are rejected") {
+    const char* columns[] = {"tag"};
+    REQUIRE(lancedb_table_create_scalar_index(
+        table, columns, 1, LANCEDB_INDEX_IVF_PQ, &config, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
+
+  lancedb_table_free(table);
+}
+
@@ -4,6 +4,8 @@
  */
 
 #include "test_common.h"
+#include <future>
+#include <set>
 
 void verify_query_result(LanceDBQueryResult* query_result, size_t expected_rows) {
   // Convert to Arrow
@@ -333,3 +335,507 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Query - Where Filter no Index", "[quer
   lancedb_table_free(table);
 }
 
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Query - streaming results", "[query]") {
+  const std::string table_name = "query_stream_test";
+
+  constexpr size_t total_rows = 100;
+  // Create table with data
+  LanceDBTable* table = create_table_with_data(table_name, total_rows, 0);
+  REQUIRE(table != nullptr);
+
+  SECTION("Read result batch by batch") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+
+    LanceDBQueryResult* query_result = lancedb_query_execute(query);
+    REQUIRE(query_result != nullptr);
+
+    // Schema is available before any batch is read
+    FFI_ArrowSchema* result_schema = nullptr;
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_query_result_schema(query_result, &result_schema, &error_message);
+    if (error_message) {
+      INFO("Error getting schema: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(result_schema != nullptr);
+    REQUIRE(reinterpret_cast<ArrowSchema*>(result_schema)->n_children == 2);
+    lancedb_free_arrow_schema(result_schema);
+
+    size_t sum_rows = 0;
+    while (true) {
+      FFI_ArrowArray* batch = nullptr;
+      error_message = nullptr;
+      result = lancedb_query_result_next_batch(query_result, &batch, &error_message);
+      if (error_message) {
+        INFO("Error reading batch: " << error_message);
+        lancedb_free_string(error_message);
+      }
+      REQUIRE(result == LANCEDB_SUCCESS);
+      if (batch == nullptr) {
+        break;
+      }
+      sum_rows += reinterpret_cast<ArrowArray*>(batch)->length;
+      lancedb_free_arrow_array(batch);
+    }
+    REQUIRE(sum_rows == total_rows);
+
+    // Reading past the end keeps returning no batch
+    FFI_ArrowArray* batch = nullptr;
+    REQUIRE(lancedb_query_result_next_batch(query_result, &batch, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(batch == nullptr);
+
+    lancedb_query_result_free(query_result);
+  }
+
+  SECTION("Read batches into a reused caller buffer") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+
+    LanceDBQueryResult* query_result = lancedb_query_execute(query);
+    REQUIRE(query_result != nullptr);
+
+    // Schema is exported once and shared by all batches
+    FFI_ArrowSchema* result_schema = nullptr;
+    REQUIRE(lancedb_query_result_schema(query_result, &result_schema, nullptr) == LANCEDB_SUCCESS);
+    auto schema = arrow::ImportSchema(reinterpret_cast<ArrowSchema*>(result_schema));
+    REQUIRE(schema.ok());
+    lancedb_free_arrow_schema(result_schema);
+
+    constexpr size_t capacity = 2;
+    ArrowArray arrays[capacity];
+    size_t sum_rows = 0;
+    std::set<std::string> keys;
+    while (true) {
+      size_t count = 0;
+      char* error_message = nullptr;
+      LanceDBError result = lancedb_query_result_next_batches(
+          query_result, reinterpret_cast<FFI_ArrowArray*>(arrays), capacity, &count, &error_message);
+      if (error_message) {
+        INFO("Error reading batches: " << error_message);
+        lancedb_free_string(error_message);
+      }
+      REQUIRE(result == LANCEDB_SUCCESS);
+      REQUIRE(count <= capacity);
+
+      for (size_t i = 0; i < count; i++) {
+        auto batch = arrow::ImportRecordBatch(&arrays[i], *schema);
+        REQUIRE(batch.ok());
+        sum_rows += (*batch)->num_rows();
+        auto key_array = std::static_pointer_cast<arrow::StringArray>((*batch)->GetColumnByName("key"));
+        for (int64_t row = 0; row < key_array->length(); row++) {
+          keys.insert(key_array->GetString(row));
+        }
+      }
+      if (count < capacity) {
+        break;
+      }
+    }
+    REQUIRE(sum_rows == total_rows);
+    REQUIRE(keys.size() == total_rows);
+
+    // Reading past the end writes no batch
+    size_t count = 1;
+    REQUIRE(lancedb_query_result_next_batches(
+        query_result, reinterpret_cast<FFI_ArrowArray*>(arrays), capacity, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 0);
+
+    lancedb_query_result_free(query_result);
+  }
+
+  SECTION("Export result as Arrow C stream") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+
+    LanceDBQueryResult* query_result = lancedb_query_execute(query);
+    REQUIRE(query_result != nullptr);
+
+    struct ArrowArrayStream c_stream;
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_query_result_to_arrow_stream(
+        query_result, reinterpret_cast<FFI_ArrowArrayStream*>(&c_stream), &error_message);
+    if (error_message) {
+      INFO("Error exporting stream: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+
+    auto reader = arrow::ImportRecordBatchReader(&c_stream);
+    REQUIRE(reader.ok());
+    REQUIRE((*reader)->schema()->num_fields() == 2);
+
+    int64_t sum_rows = 0;
+    std::shared_ptr<arrow::RecordBatch> batch;
+    while (true) {
+      REQUIRE((*reader)->ReadNext(&batch).ok());
+      if (!batch) {
+        break;
+      }
+      sum_rows += batch->num_rows();
+    }
+    REQUIRE(sum_rows == static_cast<int64_t>(total_rows));
+  }
+
+  SECTION("NULL arguments should fail") {
+    FFI_ArrowArray* batch = nullptr;
+    REQUIRE(lancedb_query_result_next_batch(nullptr, &batch, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    ArrowArray arrays[1];
+    size_t count = 0;
+    REQUIRE(lancedb_query_result_next_batches(
+        nullptr, reinterpret_cast<FFI_ArrowArray*>(arrays), 1, &count, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_query_result_to_arrow_stream(nullptr, nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Query - async execution", "[query]") {
+  const std::string table_name = "query_async_test";
+
+  constexpr size_t total_rows = 100;
+  // Create table with data
+  LanceDBTable* table = create_table_with_data(table_name, total_rows, 0);
+  REQUIRE(table != nullptr);
+
+  SECTION("Execute query with completion callback") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+
+    std::promise<void> done;
+    auto on_complete = [](void* user_data) {
+      static_cast<std::promise<void>*>(user_data)->set_value();
+    };
+    LanceDBFuture* future = lancedb_query_execute_async(query, on_complete, &done);
+    REQUIRE(future != nullptr);
+
+    // Wait for the callback, the result must then be available without blocking
+    REQUIRE(done.get_future().wait_for(std::chrono::seconds(60)) == std::future_status::ready);
+    REQUIRE(lancedb_future_is_ready(future) == 1);
+
+    LanceDBQueryResult* query_result = nullptr;
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_future_get_query_result(future, &query_result, &error_message);
+    if (error_message) {
+      INFO("Error getting query result: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(query_result != nullptr);
+    verify_query_result(query_result, total_rows);
+  }
+
+  SECTION("Execute query without callback and wait for result") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_query_where_filter(query, "key = \"key_42\"", nullptr) == LANCEDB_SUCCESS);
+
+    LanceDBFuture* future = lancedb_query_execute_async(query, nullptr, nullptr);
+    REQUIRE(future != nullptr);
+
+    LanceDBQueryResult* query_result = nullptr;
+    REQUIRE(lancedb_future_get_query_result(future, &query_result, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(query_result != nullptr);
+    verify_query_result(query_result, 1);
+  }
+
+  SECTION("Async query error is reported when resolving the future") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_query_where_filter(query, "no_such_column = 1", nullptr) == LANCEDB_SUCCESS);
+
+    LanceDBFuture* future = lancedb_query_execute_async(query, nullptr, nullptr);
+    REQUIRE(future != nullptr);
+
+    LanceDBQueryResult* query_result = nullptr;
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_future_get_query_result(future, &query_result, &error_message);
+    REQUIRE(result != LANCEDB_SUCCESS);
+    REQUIRE(query_result == nullptr);
+    if (error_message) {
+      INFO("Expected error: " << error_message);
+      lancedb_free_string(error_message);
+    }
+  }
+
+  SECTION("Freeing a future still invokes its callback") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+
+    std::promise<void> done;
+    auto on_complete = [](void* user_data) {
+      static_cast<std::promise<void>*>(user_data)->set_value();
+    };
+    LanceDBFuture* future = lancedb_query_execute_async(query, on_complete, &done);
+    REQUIRE(future != nullptr);
+
+    // Whether the query finished or was cancelled, the callback fires exactly once
+    lancedb_future_free(future);
+    REQUIRE(done.get_future().wait_for(std::chrono::seconds(60)) == std::future_status::ready);
+  }
+
+  SECTION("NULL query should fail") {
+    REQUIRE(lancedb_query_execute_async(nullptr, nullptr, nullptr) == nullptr);
+    REQUIRE(lancedb_future_get(nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Query - full-text and hybrid search", "[query]") {
+  const std::string table_name = "test_fts_query_table";
+  constexpr size_t row_num = 20;
+  LanceDBTable* table = create_table_with_data(table_name, row_num, 0);
+  REQUIRE(table != nullptr);
+
+  // Keys "key_<n>" are tokenized into "key" and "<n>"
+  const char* fts_columns[] = {"key"};
+  char* error_message = nullptr;
+  LanceDBError result = lancedb_table_create_fts_index(table, fts_columns, 1, nullptr, &error_message);
+  if (error_message) {
+    INFO("Error creating FTS index: " << error_message);
+    lancedb_free_string(error_message);
+  }
+  REQUIRE(result == LANCEDB_SUCCESS);
+
+  // Collect the result and check the number of rows and a column name
+  auto check_result = [](LanceDBQueryResult* query_result, size_t expected_rows, const std::string& column) {
+    REQUIRE(query_result != nullptr);
+    FFI_ArrowArray** result_arrays = nullptr;
+    FFI_ArrowSchema* result_schema = nullptr;
+    size_t count = 0;
+    REQUIRE(lancedb_query_result_to_arrow(query_result, &result_arrays, &result_schema, &count, nullptr) == LANCEDB_SUCCESS);
+
+    size_t sum_rows = 0;
+    for (size_t i = 0; i < count; i++) {
+      sum_rows += reinterpret_cast<ArrowArray*>(result_arrays[i])->length;
+    }
+    REQUIRE(sum_rows == expected_rows);
+
+    bool found = false;
+    ArrowSchema* schema = reinterpret_cast<ArrowSchema*>(result_schema);
+    for (int64_t i = 0; schema && i < schema->n_children; i++) {
+      found = found || column == schema->children[i]->name;
+    }
+    REQUIRE(found);
+
+    lancedb_free_arrow_arrays(result_arrays, count);
+    lancedb_free_arrow_schema(result_schema);
+  };
+
+  SECTION("Full-text search") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_query_full_text_search(query, "5", fts_columns, 1, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_query_limit(query, 10, nullptr) == LANCEDB_SUCCESS);
+
+    check_result(lancedb_query_execute(query), 1, "_score");
+  }
+
+  SECTION("Hybrid search with rerankers") {
+    std::vector<float> query_vector(TEST_SCHEMA_DIMENSIONS, 0.0f);
+    LanceDBRerankerConfig rrf = {LANCEDB_RERANKER_RRF, 0.0f, -1.0f, LANCEDB_NORMALIZE_SCORE};
+    LanceDBRerankerConfig linear = {LANCEDB_RERANKER_LINEAR, 0.0f, 0.5f, LANCEDB_NORMALIZE_SCORE};
+
+    for (const auto& reranker : {rrf, linear}) {
+      LanceDBVectorQuery* query = lancedb_vector_query_new(table, query_vector.data(), TEST_SCHEMA_DIMENSIONS);
+      REQUIRE(query != nullptr);
+      REQUIRE(lancedb_vector_query_column(query, "data", nullptr) == LANCEDB_SUCCESS);
+      REQUIRE(lancedb_vector_query_limit(query, 5, nullptr) == LANCEDB_SUCCESS);
+      REQUIRE(lancedb_vector_query_full_text_search(query, "15", nullptr, 0, nullptr) == LANCEDB_SUCCESS);
+      REQUIRE(lancedb_vector_query_rerank(query, &reranker, nullptr) == LANCEDB_SUCCESS);
+
+      // The limit applies to the reranked combination of both searches
+      check_result(lancedb_vector_query_execute(query), 5, "_relevance_score");
+    }
+  }
+
+  SECTION("Invalid arguments") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_query_full_text_search(query, nullptr, nullptr, 0, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_query_full_text_search(query, "5", nullptr, 1, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_vector_query_rerank(nullptr, nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    lancedb_query_free(query);
+  }
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Query - fragment scans", "[query]") {
+  const std::string table_name = "test_fragment_table";
+  // Every add writes a new fragment
+  LanceDBTable* table = create_table_with_data(table_name, 30, 0);
+  REQUIRE(table != nullptr);
+  REQUIRE(lancedb_table_add(table, create_reader_from_batch(create_test_record_batch(30, 30)), nullptr) == LANCEDB_SUCCESS);
+  REQUIRE(lancedb_table_add(table, create_reader_from_batch(create_test_record_batch(40, 60)), nullptr) == LANCEDB_SUCCESS);
+  const unsigned long long version = lancedb_table_version(table);
+
+  // Read the keys returned by a query
+  auto read_keys = [](LanceDBQuery* query) {
+    struct ArrowArrayStream c_stream;
+    REQUIRE(lancedb_query_result_to_arrow_stream(
+        lancedb_query_execute(query), reinterpret_cast<FFI_ArrowArrayStream*>(&c_stream), nullptr) == LANCEDB_SUCCESS);
+    auto reader = arrow::ImportRecordBatchReader(&c_stream);
+    REQUIRE(reader.ok());
+    std::vector<std::string> keys;
+    std::shared_ptr<arrow::RecordBatch> batch;
+    while (true) {
+      REQUIRE((*reader)->ReadNext(&batch).ok());
+      if (!batch) {
+        break;
+      }
+      auto key_array = std::static_pointer_cast<arrow::StringArray>(batch->GetColumnByName("key"));
+      for (int64_t i = 0; i < key_array->length(); i++) {
+        keys.push_back(key_array->GetString(i));
+      }
+    }
+    return keys;
+  };
+
+  LanceDBFragmentInfo* fragments = nullptr;
+  size_t count = 0;
+  char* error_message = nullptr;
+  LanceDBError result = lancedb_table_list_fragments(table, version, &fragments, &count, &error_message);
+  if (error_message) {
+    INFO("Error listing fragments: " << error_message);
+    lancedb_free_string(error_message);
+  }
+  REQUIRE(result == LANCEDB_SUCCESS);
+  REQUIRE(count == 3);
+
+  unsigned long long listed_rows = 0;
+  for (size_t i = 0; i < count; i++) {
+    REQUIRE(fragments[i].num_deleted_rows == 0);
+    listed_rows += fragments[i].num_rows;
+  }
+  REQUIRE(listed_rows == 100);
+
+  SECTION("Fragment queries read disjoint rows covering the table") {
+    // Rows added after pinning the version are not read
+    REQUIRE(lancedb_table_add(table, create_reader_from_batch(create_test_record_batch(10, 100)), nullptr) == LANCEDB_SUCCESS);
+
+    std::set<std::string> all_keys;
+    size_t total_rows = 0;
+    for (size_t i = 0; i < count; i++) {
+      LanceDBQuery* query = lancedb_query_new(table);
+      REQUIRE(query != nullptr);
+      REQUIRE(lancedb_query_fragments(query, &fragments[i].id, 1, version, nullptr) == LANCEDB_SUCCESS);
+      auto keys = read_keys(query);
+      REQUIRE(keys.size() == fragments[i].num_rows);
+      total_rows += keys.size();
+      all_keys.insert(keys.begin(), keys.end());
+    }
+    REQUIRE(total_rows == 100);
+    REQUIRE(all_keys.size() == 100);
+  }
+
+  SECTION("Fragment queries apply filter and limit") {
+    std::vector<unsigned long long> ids;
+    for (size_t i = 0; i < count; i++) {
+      ids.push_back(fragments[i].id);
+    }
+
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_query_fragments(query, ids.data(), ids.size(), version, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_query_where_filter(query, "key IN ('key_5', 'key_45', 'key_85')", nullptr) == LANCEDB_SUCCESS);
+
+    char* plan = nullptr;
+    REQUIRE(lancedb_query_explain_plan(query, 0, &plan, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(plan != nullptr);
+    lancedb_free_string(plan);
+
+    REQUIRE(read_keys(query).size() == 3);
+
+    query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_query_fragments(query, ids.data(), ids.size(), version, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_query_limit(query, 7, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(read_keys(query).size() == 7);
+  }
+
+  SECTION("Invalid arguments") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+
+    unsigned long long missing_id = 12345;
+    error_message = nullptr;
+    REQUIRE(lancedb_query_fragments(query, &missing_id, 1, version, &error_message) == LANCEDB_INVALID_INPUT);
+    REQUIRE(error_message != nullptr);
+    lancedb_free_string(error_message);
+
+    REQUIRE(lancedb_query_fragments(query, nullptr, 1, version, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_query_fragments(query, &missing_id, 0, version, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_list_fragments(nullptr, version, &fragments, &count, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    lancedb_query_free(query);
+  }
+
+  lancedb_free_fragment_list(fragments);
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Query - explain and analyze plan", "[query]") {
+  const std::string table_name = "test_plan_table";
+  constexpr size_t row_num = 20;
+  LanceDBTable* table = create_table_with_data(table_name, row_num, 0);
+  REQUIRE(table != nullptr);
+
+  // Get a plan and check it is not empty
+  auto check_plan = [](LanceDBError result, char* plan, char* error_message) {
+    if (error_message) {
+      INFO("Error getting plan: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(plan != nullptr);
+    REQUIRE(std::string(plan).size() > 0);
+    lancedb_free_string(plan);
+  };
+
+  SECTION("Plain query") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_query_where_filter(query, "key = 'key_3'", nullptr) == LANCEDB_SUCCESS);
+
+    char* plan = nullptr;
+    char* error_message = nullptr;
+    check_plan(lancedb_query_explain_plan(query, 1, &plan, &error_message), plan, error_message);
+
+    plan = nullptr;
+    error_message = nullptr;
+    check_plan(lancedb_query_analyze_plan(query, &plan, &error_message), plan, error_message);
+
+    // The query is not consumed by the plan functions
+    LanceDBQueryResult* query_result = lancedb_query_execute(query);
+    verify_query_result(query_result, 1);
+  }
+
+  SECTION("Vector query") {
+    std::vector<float> query_vector(TEST_SCHEMA_DIMENSIONS, 0.0f);
+    LanceDBVectorQuery* query = lancedb_vector_query_new(table, query_vector.data(), TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_vector_query_column(query, "data", nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, 5, nullptr) == LANCEDB_SUCCESS);
+
+    char* plan = nullptr;
+    char* error_message = nullptr;
+    check_plan(lancedb_vector_query_explain_plan(query, 0, &plan, &error_message), plan, error_message);
+
+    plan = nullptr;
+    error_message = nullptr;
+    check_plan(lancedb_vector_query_analyze_plan(query, &plan, &error_message), plan, error_message);
+
+    lancedb_vector_query_free(query);
+  }
+
+  SECTION("Invalid arguments") {
+    char* plan = nullptr;
+    REQUIRE(lancedb_query_explain_plan(nullptr, 0, &plan, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_vector_query_analyze_plan(nullptr, &plan, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(plan == nullptr);
+  }
+
+  lancedb_table_free(table);
+}
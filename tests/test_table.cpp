@@ -4,6 +4,58 @@
  */
 
 #include "test_common.h"
+#include <map>
+#include <thread>
+
+// Batch of (key index, value) rows, with every dimension of the data vector set to value
+static std::shared_ptr<arrow::RecordBatch> create_keyed_batch(const std::vector<std::pair<int, float>>& rows) {
+  arrow::StringBuilder key_builder;
+  arrow::FixedSizeListBuilder data_builder(arrow::default_memory_pool(),
+      std::make_unique<arrow::FloatBuilder>(), TEST_SCHEMA_DIMENSIONS);
+  for (const auto& [idx, value] : rows) {
+    REQUIRE(key_builder.Append("key_" + std::to_string(idx)).ok());
+    auto list_builder = static_cast<arrow::FloatBuilder*>(data_builder.value_builder());
+    for (size_t j = 0; j < TEST_SCHEMA_DIMENSIONS; j++) {
+      REQUIRE(list_builder->Append(value).ok());
+    }
+    REQUIRE(data_builder.Append().ok());
+  }
+
+  std::shared_ptr<arrow::Array> key_array, data_array;
+  REQUIRE(key_builder.Finish(&key_array).ok());
+  REQUIRE(data_builder.Finish(&data_array).ok());
+  return arrow::RecordBatch::Make(create_test_schema(), static_cast<int64_t>(rows.size()), {key_array, data_array});
+}
+
+// First value of the data vector of every row, by key
+static std::map<std::string, float> read_first_values(LanceDBTable* table) {
+  LanceDBQuery* query = lancedb_query_new(table);
+  REQUIRE(query != nullptr);
+  LanceDBQueryResult* result = lancedb_query_execute(query);
+  REQUIRE(result != nullptr);
+  struct ArrowArrayStream c_stream;
+  REQUIRE(lancedb_query_result_to_arrow_stream(
+      result, reinterpret_cast<FFI_ArrowArrayStream*>(&c_stream), nullptr) == LANCEDB_SUCCESS);
+
+  auto reader = arrow::ImportRecordBatchReader(&c_stream);
+  REQUIRE(reader.ok());
+  std::map<std::string, float> values;
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (true) {
+    REQUIRE((*reader)->ReadNext(&batch).ok());
+    if (!batch) {
+      break;
+    }
+    auto keys = std::static_pointer_cast<arrow::StringArray>(batch->GetColumnByName("key"));
+    auto data = std::static_pointer_cast<arrow::FixedSizeListArray>(batch->GetColumnByName("data"));
+    auto floats = std::static_pointer_cast<arrow::FloatArray>(data->values());
+    for (int64_t i = 0; i < batch->num_rows(); i++) {
+      values[keys->GetString(i)] = floats->Value(data->value_offset(i));
+    }
+  }
+  lancedb_query_free(query);
+  return values;
+}
 
 TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Creation", "[table]") {
   SECTION("Create empty table") {
@@ -158,6 +210,152 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Add", "[table]") {
     REQUIRE(version == 3);
   }
 
+  SECTION("Add multiple batches from a stream in a single commit") {
+    REQUIRE(lancedb_table_version(table) == 1);
+
+    constexpr auto batch_num = 10;
+    constexpr auto batch_rows = 20;
+    std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    for (int i = 0; i < batch_num; ++i) {
+      batches.push_back(create_test_record_batch(batch_rows, i * batch_rows));
+    }
+    auto reader = create_reader_from_batches(batches);
+    REQUIRE(reader != nullptr);
+
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_add(table, reader, &error_message);
+
+    if (error_message) {
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows(table) == batch_num * batch_rows);
+
+    // All batches land in one new version
+    REQUIRE(lancedb_table_version(table) == 2);
+  }
+
+  SECTION("Reader from null stream should fail") {
+    REQUIRE(lancedb_record_batch_reader_from_arrow_stream(nullptr) == nullptr);
+  }
+
+  SECTION("Add data with write configuration") {
+    constexpr auto row_num = 50;
+    auto batch = create_test_record_batch(row_num, 0);
+    auto reader = create_reader_from_batch(batch);
+    REQUIRE(reader != nullptr);
+
+    LanceDBWriteConfig config;
+    lancedb_write_config_init(&config);
+    REQUIRE(config.struct_size == sizeof(LanceDBWriteConfig));
+    config.max_rows_per_file = 10;
+    config.max_rows_per_group = 5;
+
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_add_with_config(table, reader, &config, &error_message);
+
+    if (error_message) {
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows(table) == row_num);
+    REQUIRE(lancedb_table_version(table) == 2);
+  }
+
+  SECTION("Write config without struct size should fail") {
+    auto reader = create_reader_from_batch(create_test_record_batch(10, 0));
+    REQUIRE(reader != nullptr);
+
+    LanceDBWriteConfig config = {};
+    config.max_rows_per_file = 10;
+    REQUIRE(lancedb_table_add_with_config(table, reader, &config, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_bulk_load_new(table, &config) == nullptr);
+
+    // Reader was not consumed due to error, must free it
+    lancedb_record_batch_reader_free(reader);
+    REQUIRE(lancedb_table_count_rows(table) == 0);
+  }
+
+  SECTION("Bulk load commits all readers as one version") {
+    constexpr auto reader_num = 4;
+    constexpr auto row_num = 25;
+
+    LanceDBWriteConfig config;
+    lancedb_write_config_init(&config);
+    config.max_rows_per_file = 30;
+    LanceDBBulkLoader* loader = lancedb_table_bulk_load_new(table, &config);
+    REQUIRE(loader != nullptr);
+
+    for (int i = 0; i < reader_num; ++i) {
+      auto batch = create_test_record_batch(row_num, i * row_num);
+      auto reader = create_reader_from_batch(batch);
+      REQUIRE(reader != nullptr);
+      REQUIRE(lancedb_bulk_loader_add(loader, reader, nullptr) == LANCEDB_SUCCESS);
+    }
+
+    // Nothing is visible before the commit
+    REQUIRE(lancedb_table_count_rows(table) == 0);
+
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_bulk_loader_commit(loader, &error_message);
+
+    if (error_message) {
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows(table) == reader_num * row_num);
+    REQUIRE(lancedb_table_version(table) == 2);
+  }
+
+  SECTION("Bulk load writes each reader into its own fragments") {
+    constexpr auto reader_num = 3;
+    constexpr auto row_num = 10;
+
+    // Default layout fits all rows in one file, only concurrent writes split them
+    LanceDBBulkLoader* loader = lancedb_table_bulk_load_new(table, nullptr);
+    REQUIRE(loader != nullptr);
+    for (int i = 0; i < reader_num; ++i) {
+      auto reader = create_reader_from_batch(create_test_record_batch(row_num, i * row_num));
+      REQUIRE(reader != nullptr);
+      REQUIRE(lancedb_bulk_loader_add(loader, reader, nullptr) == LANCEDB_SUCCESS);
+    }
+    REQUIRE(lancedb_bulk_loader_commit(loader, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_version(table) == 2);
+
+    LanceDBFragmentInfo* fragments = nullptr;
+    size_t count = 0;
+    REQUIRE(lancedb_table_list_fragments(table, 0, &fragments, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == reader_num);
+    for (size_t i = 0; i < count; i++) {
+      REQUIRE(fragments[i].num_rows == row_num);
+    }
+    lancedb_free_fragment_list(fragments);
+  }
+
+  SECTION("Bulk load into a pinned table should fail") {
+    LanceDBTable* pinned = nullptr;
+    REQUIRE(lancedb_table_checkout(table, 1, &pinned, nullptr) == LANCEDB_SUCCESS);
+    LanceDBBulkLoader* loader = lancedb_table_bulk_load_new(pinned, nullptr);
+    REQUIRE(loader != nullptr);
+    auto reader = create_reader_from_batch(create_test_record_batch(5, 0));
+    REQUIRE(lancedb_bulk_loader_add(loader, reader, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_bulk_loader_commit(loader, nullptr) == LANCEDB_NOT_SUPPORTED);
+    lancedb_table_free(pinned);
+    REQUIRE(lancedb_table_version(table) == 1);
+  }
+
+  SECTION("Bulk load discarded without commit") {
+    LanceDBBulkLoader* loader = lancedb_table_bulk_load_new(table, nullptr);
+    REQUIRE(loader != nullptr);
+    auto reader = create_reader_from_batch(create_test_record_batch(5, 0));
+    REQUIRE(lancedb_bulk_loader_add(loader, reader, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_bulk_loader_add(loader, nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    lancedb_bulk_loader_free(loader);
+
+    REQUIRE(lancedb_table_count_rows(table) == 0);
+    REQUIRE(lancedb_table_version(table) == 1);
+  }
+
   SECTION("Add data with duplicate keys creates duplicate rows") {
     // Add initial data with keys 0-9
     constexpr auto row_num = 10;
@@ -199,6 +397,26 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Add", "[table]") {
     REQUIRE(version == 3);
   }
 
+  SECTION("Add data asynchronously") {
+    constexpr auto row_num = 10;
+    auto batch = create_test_record_batch(row_num, 0);
+    auto reader = create_reader_from_batch(batch);
+    REQUIRE(reader != nullptr);
+
+    LanceDBFuture* future = lancedb_table_add_async(table, reader, nullptr, nullptr);
+    REQUIRE(future != nullptr);
+
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_future_get(future, &error_message);
+    if (error_message) {
+      INFO("Error message: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows(table) == row_num);
+    REQUIRE(lancedb_table_version(table) == 2);
+  }
+
   SECTION("Add data with null reader should fail") {
     char* error_message = nullptr;
     LanceDBError result = lancedb_table_add(table, nullptr, &error_message);
@@ -297,6 +515,7 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Merge Insert", "[table]") {
 
     const char* on_columns[] = {"key"};
     LanceDBMergeInsertConfig config = {
+      .struct_size = sizeof(LanceDBMergeInsertConfig),
       .when_matched_update_all = 1,
       .when_not_matched_insert_all = 1
     };
@@ -346,6 +565,7 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Merge Insert", "[table]") {
 
     const char* on_columns[] = {"key"};
     LanceDBMergeInsertConfig config = {
+      .struct_size = sizeof(LanceDBMergeInsertConfig),
       .when_matched_update_all = 1,
       .when_not_matched_insert_all = 0  // Don't insert new rows
     };
@@ -394,6 +614,7 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Merge Insert", "[table]") {
 
     const char* on_columns[] = {"key"};
     LanceDBMergeInsertConfig config = {
+      .struct_size = sizeof(LanceDBMergeInsertConfig),
       .when_matched_update_all = 0,  // Don't update existing rows
       .when_not_matched_insert_all = 1
     };
@@ -471,6 +692,7 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Merge Insert", "[table]") {
 
     const char* on_columns[] = {"key"};
     LanceDBMergeInsertConfig config = {
+      .struct_size = sizeof(LanceDBMergeInsertConfig),
       .when_matched_update_all = 1,
       .when_not_matched_insert_all = 0
     };
@@ -493,9 +715,117 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Merge Insert", "[table]") {
     REQUIRE(version == 3);
   }
 
+  SECTION("Merge insert with conditional update") {
+    // Keys 0-4 of the source match with new values, but the condition only allows updating key_0
+    auto merge_batch = create_keyed_batch({{0, 1000.0f}, {1, 1001.0f}, {2, 1002.0f}, {3, 1003.0f}, {4, 1004.0f}});
+    auto merge_reader = create_reader_from_batch(merge_batch);
+    REQUIRE(merge_reader != nullptr);
+
+    const char* on_columns[] = {"key"};
+    LanceDBMergeInsertConfig config = {
+      .struct_size = sizeof(LanceDBMergeInsertConfig),
+      .when_matched_update_all = 1,
+      .when_not_matched_insert_all = 0,
+      .when_matched_update_filter = "target.key = 'key_0'"
+    };
+
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_merge_insert(
+        table, merge_reader, on_columns, 1, &config, &error_message);
+
+    if (error_message) {
+      INFO("Error message: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows(table) == 10);
+
+    // Only key_0 takes the source value, the other rows keep their original idx * 10
+    auto values = read_first_values(table);
+    REQUIRE(values.size() == 10);
+    REQUIRE(values["key_0"] == 1000.0f);
+    for (int i = 1; i < 10; i++) {
+      REQUIRE(values["key_" + std::to_string(i)] == static_cast<float>(i * 10));
+    }
+  }
+
+  SECTION("Merge insert deleting records not matched by source") {
+    // Source holds keys 0-4, keys 5-9 are only in the target
+    auto merge_batch = create_test_record_batch(5, 0);
+    auto merge_reader = create_reader_from_batch(merge_batch);
+    REQUIRE(merge_reader != nullptr);
+
+    const char* on_columns[] = {"key"};
+    LanceDBMergeInsertConfig config = {
+      .struct_size = sizeof(LanceDBMergeInsertConfig),
+      .when_matched_update_all = 0,
+      .when_not_matched_insert_all = 0,
+      .when_matched_update_filter = nullptr,
+      .when_not_matched_by_source_delete = 1,
+      .when_not_matched_by_source_delete_filter = "key != 'key_9'"
+    };
+
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_merge_insert(
+        table, merge_reader, on_columns, 1, &config, &error_message);
+
+    if (error_message) {
+      INFO("Error message: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+
+    // Keys 5-8 are deleted, key_9 is kept by the filter
+    REQUIRE(lancedb_table_count_rows(table) == 6);
+    REQUIRE(lancedb_table_version(table) == 3);
+  }
+
+  SECTION("Merge insert with source dedup") {
+    const char* on_columns[] = {"key"};
+    auto merge_with = [&](LanceDBMergeInsertDedup dedup_mode, LanceDBRecordBatchReader* merge_reader) {
+      REQUIRE(merge_reader != nullptr);
+      LanceDBMergeInsertConfig config = {
+        .struct_size = sizeof(LanceDBMergeInsertConfig),
+        .when_matched_update_all = 1,
+        .when_not_matched_insert_all = 1,
+        .when_matched_update_filter = nullptr,
+        .when_not_matched_by_source_delete = 0,
+        .when_not_matched_by_source_delete_filter = nullptr,
+        .source_dedup = dedup_mode
+      };
+
+      char* error_message = nullptr;
+      LanceDBError result = lancedb_table_merge_insert(
+          table, merge_reader, on_columns, 1, &config, &error_message);
+
+      if (error_message) {
+        INFO("Error message: " << error_message);
+        lancedb_free_string(error_message);
+      }
+      REQUIRE(result == LANCEDB_SUCCESS);
+    };
+
+    // key_20 appears twice, in different batches; FIRST keeps its first row
+    merge_with(LANCEDB_MERGE_DEDUP_FIRST, create_reader_from_batches(
+        {create_keyed_batch({{20, 1.0f}, {21, 2.0f}}), create_keyed_batch({{20, 3.0f}})}));
+    REQUIRE(lancedb_table_count_rows(table) == 12);
+    auto values = read_first_values(table);
+    REQUIRE(values["key_20"] == 1.0f);
+    REQUIRE(values["key_21"] == 2.0f);
+
+    // The second merge finds both keys and updates them; LAST keeps the last row of key_20
+    merge_with(LANCEDB_MERGE_DEDUP_LAST, create_reader_from_batches(
+        {create_keyed_batch({{20, 4.0f}, {21, 5.0f}}), create_keyed_batch({{20, 6.0f}})}));
+    REQUIRE(lancedb_table_count_rows(table) == 12);
+    values = read_first_values(table);
+    REQUIRE(values["key_20"] == 6.0f);
+    REQUIRE(values["key_21"] == 5.0f);
+  }
+
   SECTION("Merge insert with null reader should fail") {
     const char* on_columns[] = {"key"};
     LanceDBMergeInsertConfig config = {
+      .struct_size = sizeof(LanceDBMergeInsertConfig),
       .when_matched_update_all = 1,
       .when_not_matched_insert_all = 1
     };
@@ -518,6 +848,7 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Merge Insert", "[table]") {
 
     const char* on_columns[] = {"key"};
     LanceDBMergeInsertConfig config = {
+      .struct_size = sizeof(LanceDBMergeInsertConfig),
       .when_matched_update_all = 1,
       .when_not_matched_insert_all = 1
     };
@@ -542,6 +873,7 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Merge Insert", "[table]") {
     REQUIRE(merge_reader != nullptr);
 
     LanceDBMergeInsertConfig config = {
+      .struct_size = sizeof(LanceDBMergeInsertConfig),
       .when_matched_update_all = 1,
       .when_not_matched_insert_all = 1
     };
@@ -560,6 +892,313 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Merge Insert", "[table]") {
     }
   }
 
+  SECTION("Merge insert config without struct size uses the first layout") {
+    const char* on_columns[] = {"key"};
+
+    // A designated initializer written before struct_size existed leaves it at 0
+    LanceDBMergeInsertConfig config = {
+      .when_matched_update_all = 0,
+      .when_not_matched_insert_all = 1
+    };
+    REQUIRE(config.struct_size == 0);
+    REQUIRE(lancedb_table_merge_insert(table, create_reader_from_batch(create_test_record_batch(3, 100)),
+        on_columns, 1, &config, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows(table) == 13);
+
+    // A struct too small to hold struct_size is rejected
+    auto merge_reader = create_reader_from_batch(create_test_record_batch(3, 0));
+    REQUIRE(merge_reader != nullptr);
+    config.struct_size = sizeof(size_t) - 1;
+    REQUIRE(lancedb_table_merge_insert(table, merge_reader, on_columns, 1, &config, nullptr) ==
+            LANCEDB_INVALID_ARGUMENT);
+
+    // An initialized config is accepted
+    lancedb_merge_insert_config_init(&config);
+    REQUIRE(config.struct_size == sizeof(LanceDBMergeInsertConfig));
+    REQUIRE(config.when_matched_update_all == 1);
+    REQUIRE(lancedb_table_merge_insert(table, merge_reader, on_columns, 1, &config, nullptr) ==
+            LANCEDB_SUCCESS);
+  }
+
+  lancedb_table_free(table);
+}
+
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Snapshot", "[table]") {
+  const std::string table_name = "snapshot_table";
+  LanceDBTable* table = create_table_with_data(table_name, 10, 0);
+  REQUIRE(table != nullptr);
+
+  SECTION("Snapshot returns version and schema") {
+    unsigned long long version = 0;
+    FFI_ArrowSchema* c_schema = nullptr;
+    REQUIRE(lancedb_table_snapshot(table, -1, &version, &c_schema, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(version == lancedb_table_version(table));
+    REQUIRE(c_schema != nullptr);
+
+    auto schema = arrow::ImportSchema(reinterpret_cast<ArrowSchema*>(c_schema));
+    REQUIRE(schema.ok());
+    REQUIRE(schema.ValueOrDie()->Equals(*create_test_schema()));
+    lancedb_free_arrow_schema(c_schema);
+  }
+
+  SECTION("Writes through the handle refresh the snapshot") {
+    unsigned long long version = 0;
+    REQUIRE(lancedb_table_snapshot(table, -1, &version, nullptr, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_add(table, create_reader_from_batch(create_test_record_batch(5, 10)), nullptr) == LANCEDB_SUCCESS);
+
+    unsigned long long new_version = 0;
+    REQUIRE(lancedb_table_snapshot(table, -1, &new_version, nullptr, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(new_version == version + 1);
+  }
+
+  SECTION("Writes through other connections respect max staleness") {
+    unsigned long long version = 0;
+    REQUIRE(lancedb_table_snapshot(table, -1, &version, nullptr, nullptr) == LANCEDB_SUCCESS);
+
+    LanceDBConnection* other = lancedb_connect_builder_execute(lancedb_connect(uri.c_str()));
+    REQUIRE(other != nullptr);
+    LanceDBTable* other_table = lancedb_connection_open_table(other, table_name.c_str());
+    REQUIRE(other_table != nullptr);
+    REQUIRE(lancedb_table_add(other_table, create_reader_from_batch(create_test_record_batch(5, 10)), nullptr) == LANCEDB_SUCCESS);
+    lancedb_table_free(other_table);
+    lancedb_connection_free(other);
+
+    // Without a read consistency interval the cached snapshot is kept
+    unsigned long long cached_version = 0;
+    REQUIRE(lancedb_table_snapshot(table, -1, &cached_version, nullptr, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(cached_version == version);
+
+    // A zero staleness bound always reads the table again
+    unsigned long long fresh_version = 0;
+    REQUIRE(lancedb_table_snapshot(table, 0, &fresh_version, nullptr, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(fresh_version == lancedb_table_version(table));
+  }
+
+  SECTION("NULL table should fail") {
+    unsigned long long version = 0;
+    REQUIRE(lancedb_table_snapshot(nullptr, -1, &version, nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Checkout", "[table]") {
+  const std::string table_name = "checkout_table";
+  LanceDBTable* table = create_table_with_data(table_name, 10, 0);
+  REQUIRE(table != nullptr);
+  const unsigned long long version = lancedb_table_version(table);
+
+  SECTION("Pinned table ignores later writes") {
+    LanceDBTable* pinned = nullptr;
+    REQUIRE(lancedb_table_checkout(table, version, &pinned, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(pinned != nullptr);
+
+    REQUIRE(lancedb_table_add(table, create_reader_from_batch(create_test_record_batch(5, 10)), nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows(table) == 15);
+    REQUIRE(lancedb_table_count_rows(pinned) == 10);
+    REQUIRE(lancedb_table_version(pinned) == version);
+
+    // Queries run against the pinned version
+    LanceDBQuery* query = lancedb_query_new(pinned);
+    REQUIRE(query != nullptr);
+    LanceDBQueryResult* result = lancedb_query_execute(query);
+    REQUIRE(result != nullptr);
+    FFI_ArrowArray** arrays = nullptr;
+    FFI_ArrowSchema* schema = nullptr;
+    size_t count = 0;
+    REQUIRE(lancedb_query_result_to_arrow(result, &arrays, &schema, &count, nullptr) == LANCEDB_SUCCESS);
+    int64_t rows = 0;
+    for (size_t i = 0; i < count; i++) {
+      rows += reinterpret_cast<ArrowArray*>(arrays[i])->length;
+    }
+    REQUIRE(rows == 10);
+    lancedb_free_arrow_arrays(arrays, count);
+    lancedb_free_arrow_schema(schema);
+    lancedb_query_result_free(result);
+    lancedb_query_free(query);
+
+    lancedb_table_free(pinned);
+  }
+
+  SECTION("Pinned table is read-only") {
+    LanceDBTable* pinned = nullptr;
+    REQUIRE(lancedb_table_checkout(table, version, &pinned, nullptr) == LANCEDB_SUCCESS);
+    char* error_message = nullptr;
+    REQUIRE(lancedb_table_add(pinned, create_reader_from_batch(create_test_record_batch(5, 10)), &error_message) != LANCEDB_SUCCESS);
+    REQUIRE(error_message != nullptr);
+    lancedb_free_string(error_message);
+    REQUIRE(lancedb_table_count_rows(table) == 10);
+    lancedb_table_free(pinned);
+  }
+
+  SECTION("Invalid arguments should fail") {
+    LanceDBTable* pinned = nullptr;
+    REQUIRE(lancedb_table_checkout(nullptr, version, &pinned, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_checkout(table, version, nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_checkout(table, 0, &pinned, nullptr) == LANCEDB_INVALID_ARGUMENT);
+
+    char* error_message = nullptr;
+    REQUIRE(lancedb_table_checkout(table, version + 100, &pinned, &error_message) != LANCEDB_SUCCESS);
+    REQUIRE(pinned == nullptr);
+    lancedb_free_string(error_message);
+  }
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Count Rows", "[table]") {
+  const std::string table_name = "count_rows_table";
+  LanceDBTable* table = create_table_with_data(table_name, 10, 0);
+  REQUIRE(table != nullptr);
+
+  SECTION("Count all and filtered rows") {
+    unsigned long long count = 0;
+    REQUIRE(lancedb_table_count_rows_filtered(table, nullptr, 0, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 10);
+    REQUIRE(lancedb_table_count_rows_filtered(table, "key = 'key_3'", 0, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 1);
+    REQUIRE(lancedb_table_count_rows_filtered(table, "key IN ('key_1', 'key_2', 'no_key')", 0, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 2);
+    REQUIRE(lancedb_table_count_rows_filtered(table, "key = 'no_key'", 0, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 0);
+  }
+
+  SECTION("Count rows using a scalar index") {
+    const char* columns[] = {"key"};
+    LanceDBScalarIndexConfig config = {
+      .replace = 0,
+      .force_update_statistics = 0
+    };
+    REQUIRE(lancedb_table_create_scalar_index(table, columns, 1, LANCEDB_INDEX_BTREE, &config, nullptr) == LANCEDB_SUCCESS);
+
+    unsigned long long count = 0;
+    REQUIRE(lancedb_table_count_rows_filtered(table, "key >= 'key_5'", 0, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 5);
+  }
+
+  SECTION("Invalid filter reports an error") {
+    unsigned long long count = 1234;
+    char* error_message = nullptr;
+    REQUIRE(lancedb_table_count_rows_filtered(table, "no_such_column = 1", 0, &count, &error_message) != LANCEDB_SUCCESS);
+    REQUIRE(error_message != nullptr);
+    lancedb_free_string(error_message);
+  }
+
+  SECTION("Cached counts respect max staleness and writes") {
+    unsigned long long count = 0;
+    REQUIRE(lancedb_table_count_rows_filtered(table, "key < 'key_5'", 60000, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 5);
+
+    // Repeated counts are served from memory
+    LanceDBOperationMetrics metrics;
+    REQUIRE(lancedb_metrics_operation("table_count_rows_filtered", &metrics, nullptr) == LANCEDB_SUCCESS);
+    const auto counted = metrics.calls;
+    REQUIRE(lancedb_table_count_rows_filtered(table, "key < 'key_5'", 60000, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 5);
+    REQUIRE(lancedb_metrics_operation("table_count_rows_filtered", &metrics, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(metrics.calls == counted);
+
+    // A zero staleness bound always counts again
+    REQUIRE(lancedb_table_count_rows_filtered(table, "key < 'key_5'", 0, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 5);
+    REQUIRE(lancedb_metrics_operation("table_count_rows_filtered", &metrics, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(metrics.calls == counted + 1);
+
+    // Writes through the handle drop the cached count
+    REQUIRE(lancedb_table_delete(table, "key = 'key_1'", nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows_filtered(table, "key < 'key_5'", 60000, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 4);
+  }
+
+  SECTION("Approximate count from manifest statistics") {
+    unsigned long long count = 0;
+    REQUIRE(lancedb_table_count_rows_approx(table, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 10);
+
+    // Deletions are recorded in the manifest
+    REQUIRE(lancedb_table_delete(table, "key IN ('key_1', 'key_2')", nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_count_rows_approx(table, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 8);
+  }
+
+  SECTION("Invalid arguments should fail") {
+    unsigned long long count = 0;
+    REQUIRE(lancedb_table_count_rows_filtered(nullptr, nullptr, 0, &count, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_count_rows_filtered(table, nullptr, 0, nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_count_rows_approx(nullptr, &count, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_count_rows_approx(table, nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
+
   lancedb_table_free(table);
 }
 
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Table Maintenance", "[table]") {
+  const std::string table_name = "maintenance_table";
+  LanceDBTable* table = create_table_with_data(table_name, 10, 0);
+  REQUIRE(table != nullptr);
+  // Every add creates a new fragment and a new version
+  for (int i = 1; i < 4; i++) {
+    REQUIRE(lancedb_table_add(table, create_reader_from_batch(create_test_record_batch(10, i * 10)), nullptr) == LANCEDB_SUCCESS);
+  }
+  REQUIRE(lancedb_table_version(table) == 4);
+
+  SECTION("Compact files") {
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_compact_files(table, &error_message);
+    if (error_message) {
+      INFO("Error message: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_version(table) == 5);
+    REQUIRE(lancedb_table_count_rows(table) == 40);
+  }
+
+  SECTION("Cleanup old versions") {
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_cleanup_old_versions(table, 0, 0, &error_message);
+    if (error_message) {
+      INFO("Error message: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_version(table) == 4);
+    REQUIRE(lancedb_table_count_rows(table) == 40);
+  }
+
+  SECTION("Maintenance scheduler compacts tables") {
+    lancedb_metrics_reset();
+    LanceDBMaintenanceConfig config = {
+      .interval_ms = 50,
+      .pause_ms = 0,
+      .compact_min_fragments = 2,
+      .optimize_min_unindexed_rows = 0,
+      .cleanup_min_versions = 0,
+      .cleanup_older_than_days = 7
+    };
+    LanceDBMaintenanceScheduler* scheduler = lancedb_maintenance_scheduler_new(&config);
+    REQUIRE(scheduler != nullptr);
+    REQUIRE(lancedb_maintenance_scheduler_add_table(scheduler, table, nullptr) == LANCEDB_SUCCESS);
+
+    LanceDBOperationMetrics metrics = {};
+    for (int i = 0; i < 200 && metrics.calls == 0; i++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      REQUIRE(lancedb_metrics_operation("maintenance_compact_files", &metrics, nullptr) == LANCEDB_SUCCESS);
+    }
+    lancedb_maintenance_scheduler_free(scheduler);
+
+    REQUIRE(metrics.calls >= 1);
+    REQUIRE(metrics.errors == 0);
+    REQUIRE(lancedb_table_count_rows(table) == 40);
+  }
+
+  SECTION("Invalid arguments should fail") {
+    REQUIRE(lancedb_table_compact_files(nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_cleanup_old_versions(nullptr, 7, 0, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_maintenance_scheduler_new(nullptr) == nullptr);
+    REQUIRE(lancedb_maintenance_scheduler_add_table(nullptr, table, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
+
+  lancedb_table_free(table);
+}
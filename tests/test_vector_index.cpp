@@ -207,6 +207,96 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Index", "[vector_index]") {
     lancedb_table_free(table);
   }
 
+  SECTION("Create IVF_SQ and IVF_RQ indices on table with existing data") {
+    LanceDBTable* table = create_table_with_data(table_name, 256, 0);
+    REQUIRE(table != nullptr);
+
+    const char* columns[] = {"data"};
+    LanceDBVectorIndexConfig config = {
+      .num_partitions = -1,
+      .num_sub_vectors = -1,
+      .max_iterations = -1,
+      .sample_rate = 0.0f,
+      .distance_type = LANCEDB_DISTANCE_L2,
+      .accelerator = nullptr,
+      .replace = 1
+    };
+
+    for (LanceDBIndexType index_type : {LANCEDB_INDEX_IVF_SQ, LANCEDB_INDEX_IVF_RQ}) {
+      char* error_message = nullptr;
+      LanceDBError result = lancedb_table_create_vector_index(
+          table, columns, 1, index_type, &config, &error_message);
+      if (error_message) {
+        INFO("Error message: " << error_message);
+        lancedb_free_string(error_message);
+      }
+      REQUIRE(result == LANCEDB_SUCCESS);
+
+      LanceDBIndexStats stats;
+      REQUIRE(lancedb_table_index_stats(table, "data_idx", &stats, nullptr) == LANCEDB_SUCCESS);
+      REQUIRE(stats.index_type == index_type);
+      REQUIRE(stats.num_indexed_rows == 256);
+    }
+
+    // Quantized indices are used together with a refine step on the full vectors
+    std::vector<float> query_vector(TEST_SCHEMA_DIMENSIONS, 1.0f);
+    LanceDBVectorQuery* query = lancedb_vector_query_new(table, query_vector.data(), TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_vector_query_limit(query, 10, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_refine_factor(query, 4, nullptr) == LANCEDB_SUCCESS);
+    LanceDBQueryResult* query_result = lancedb_vector_query_execute(query);
+    REQUIRE(query_result != nullptr);
+    lancedb_query_result_free(query_result);
+
+    lancedb_table_free(table);
+  }
+
+  SECTION("Create IVF_HNSW_PQ index with advanced build parameters") {
+    LanceDBTable* table = create_table_with_data(table_name, 256, 0);
+    REQUIRE(table != nullptr);
+
+    const char* columns[] = {"data"};
+    LanceDBVectorIndexConfig config = {
+      .num_partitions = -1,
+      .num_sub_vectors = -1,
+      .max_iterations = -1,
+      .sample_rate = 0.0f,
+      .distance_type = LANCEDB_DISTANCE_L2,
+      .accelerator = nullptr,
+      .replace = 1
+    };
+
+    LanceDBVectorIndexParams params;
+    lancedb_vector_index_params_init(&params);
+    REQUIRE(params.struct_size == sizeof(LanceDBVectorIndexParams));
+    REQUIRE(params.m == 0);
+    params.m = 8;
+    params.ef_construction = 50;
+    params.num_bits = 8;
+    params.target_partition_size = 128;
+
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_create_vector_index_with_params(
+        table, columns, 1, LANCEDB_INDEX_IVF_HNSW_PQ, &config, &params, &error_message);
+    if (error_message) {
+      INFO("Error message: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+
+    // A caller built against an older, smaller struct gets defaults for the newer fields
+    params.struct_size = offsetof(LanceDBVectorIndexParams, num_bits);
+    params.num_bits = 3;
+    REQUIRE(lancedb_table_create_vector_index_with_params(
+        table, columns, 1, LANCEDB_INDEX_IVF_HNSW_PQ, &config, &params, nullptr) == LANCEDB_SUCCESS);
+
+    params.struct_size = 0;
+    REQUIRE(lancedb_table_create_vector_index_with_params(
+        table, columns, 1, LANCEDB_INDEX_IVF_HNSW_PQ, &config, &params, nullptr) == LANCEDB_INVALID_ARGUMENT);
+
+    lancedb_table_free(table);
+  }
+
   SECTION("Create IVF_FLAT index on empty table should fail") {
     // Create empty table
     create_empty_table(table_name);
@@ -278,6 +368,46 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Index", "[vector_index]") {
 
     lancedb_table_free(table);
   }
+
+  SECTION("Unavailable accelerator should fail without creating an index") {
+    LanceDBTable* table = create_table_with_data(table_name, 256, 0);
+    REQUIRE(table != nullptr);
+
+    const char* columns[] = {"data"};
+    LanceDBVectorIndexConfig config = {
+      .num_partitions = -1,
+      .num_sub_vectors = -1,
+      .max_iterations = -1,
+      .sample_rate = 0.0f,
+      .distance_type = LANCEDB_DISTANCE_L2,
+      .accelerator = "cuda",
+      .replace = 0
+    };
+
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_create_vector_index(
+        table, columns, 1, LANCEDB_INDEX_IVF_PQ, &config, &error_message);
+    REQUIRE(result == LANCEDB_NOT_SUPPORTED);
+    REQUIRE(error_message != nullptr);
+    lancedb_free_string(error_message);
+
+    // No CPU fallback took place
+    char** indices = nullptr;
+    size_t count = 0;
+    REQUIRE(lancedb_table_list_indices(table, &indices, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(count == 0);
+    lancedb_free_index_list(indices, count);
+
+    config.accelerator = "tpu";
+    REQUIRE(lancedb_table_create_vector_index(
+        table, columns, 1, LANCEDB_INDEX_IVF_PQ, &config, nullptr) == LANCEDB_INVALID_INPUT);
+
+    config.accelerator = "cpu";
+    REQUIRE(lancedb_table_create_vector_index(
+        table, columns, 1, LANCEDB_INDEX_IVF_PQ, &config, nullptr) == LANCEDB_SUCCESS);
+
+    lancedb_table_free(table);
+  }
 }
 
 TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Index List and Drop", "[vector_index]") {
@@ -444,5 +574,100 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Index List and Drop", "[vector_
 
     lancedb_table_free(table);
   }
+
+  SECTION("Prewarm vector index") {
+    LanceDBTable* table = create_table_with_data(table_name, 256, 0);
+    REQUIRE(table != nullptr);
+
+    const char* columns[] = {"data"};
+    LanceDBVectorIndexConfig config = {
+      .num_partitions = -1,
+      .num_sub_vectors = -1,
+      .max_iterations = -1,
+      .sample_rate = 0.0f,
+      .distance_type = LANCEDB_DISTANCE_L2,
+      .accelerator = nullptr,
+      .replace = 0
+    };
+    REQUIRE(lancedb_table_create_vector_index(
+        table, columns, 1, LANCEDB_INDEX_IVF_FLAT, &config, nullptr) == LANCEDB_SUCCESS);
+
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_prewarm_index(table, "data_idx", &error_message);
+    if (error_message) {
+      INFO("Error message: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+
+    // Prewarming a missing index should fail
+    error_message = nullptr;
+    result = lancedb_table_prewarm_index(table, "no_such_idx", &error_message);
+    REQUIRE(result != LANCEDB_SUCCESS);
+    REQUIRE(error_message != nullptr);
+    lancedb_free_string(error_message);
+
+    REQUIRE(lancedb_table_prewarm_index(nullptr, "data_idx", nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_prewarm_index(table, nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+
+    lancedb_table_free(table);
+  }
+  SECTION("Index statistics and incremental update") {
+    LanceDBTable* table = create_table_with_data(table_name, 256, 0);
+    REQUIRE(table != nullptr);
+
+    const char* columns[] = {"data"};
+    LanceDBVectorIndexConfig config = {
+      .num_partitions = -1,
+      .num_sub_vectors = -1,
+      .max_iterations = -1,
+      .sample_rate = 0.0f,
+      .distance_type = LANCEDB_DISTANCE_L2,
+      .accelerator = nullptr,
+      .replace = 0
+    };
+    REQUIRE(lancedb_table_create_vector_index(
+        table, columns, 1, LANCEDB_INDEX_IVF_FLAT, &config, nullptr) == LANCEDB_SUCCESS);
+
+    LanceDBIndexStats stats;
+    REQUIRE(lancedb_table_index_stats(table, "data_idx", &stats, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(stats.index_type == LANCEDB_INDEX_IVF_FLAT);
+    REQUIRE(stats.num_indexed_rows == 256);
+    REQUIRE(stats.num_unindexed_rows == 0);
+
+    // Rows added after the index was built are reported as unindexed
+    REQUIRE(lancedb_table_add(table, create_reader_from_batch(create_test_record_batch(64, 256)), nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_table_index_stats(table, "data_idx", &stats, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(stats.num_indexed_rows == 256);
+    REQUIRE(stats.num_unindexed_rows == 64);
+    uint32_t num_indices = stats.num_indices;
+
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_update_index(table, "data_idx", 0, &error_message);
+    if (error_message) {
+      INFO("Error message: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+
+    // The new rows went to a new delta, the existing index was not rebuilt
+    REQUIRE(lancedb_table_index_stats(table, "data_idx", &stats, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(stats.num_indexed_rows == 320);
+    REQUIRE(stats.num_unindexed_rows == 0);
+    if (num_indices > 0) {
+      REQUIRE(stats.num_indices == num_indices + 1);
+    }
+
+    error_message = nullptr;
+    REQUIRE(lancedb_table_index_stats(table, "no_such_idx", &stats, &error_message) == LANCEDB_INDEX_NOT_FOUND);
+    REQUIRE(error_message != nullptr);
+    lancedb_free_string(error_message);
+
+    REQUIRE(lancedb_table_index_stats(nullptr, "data_idx", &stats, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_index_stats(table, "data_idx", nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_update_index(table, nullptr, 0, nullptr) == LANCEDB_INVALID_ARGUMENT);
+
+    lancedb_table_free(table);
+  }
 }
 
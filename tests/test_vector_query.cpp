@@ -4,6 +4,8 @@
  */
 
 #include "test_common.h"
+#include <arrow/util/float16.h>
+#include <cmath>
 #include <random>
 
 // Helper function to generate random query vector
@@ -20,6 +22,33 @@ static std::vector<float> generate_random_query_vector(size_t dimensions) {
   return query_vector;
 }
 
+// Helper function to execute a vector query and count the result rows
+static size_t execute_and_count_rows(LanceDBVectorQuery* query) {
+  LanceDBQueryResult* query_result = lancedb_vector_query_execute(query);
+  REQUIRE(query_result != nullptr);
+
+  FFI_ArrowArray** result_arrays = nullptr;
+  FFI_ArrowSchema* result_schema = nullptr;
+  size_t count = 0;
+  char* error_message = nullptr;
+  LanceDBError result = lancedb_query_result_to_arrow(
+      query_result, &result_arrays, &result_schema, &count, &error_message);
+  if (error_message) {
+    INFO("Error converting to Arrow: " << error_message);
+    lancedb_free_string(error_message);
+  }
+  REQUIRE(result == LANCEDB_SUCCESS);
+
+  size_t sum_rows = 0;
+  for (size_t i = 0; i < count; i++) {
+    sum_rows += reinterpret_cast<ArrowArray*>(result_arrays[i])->length;
+  }
+
+  lancedb_free_arrow_arrays(result_arrays, count);
+  lancedb_free_arrow_schema(result_schema);
+  return sum_rows;
+}
+
 TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Query - nearest_to without index", "[vector_query]") {
   const std::string table_name = "vector_query_test";
   constexpr size_t total_rows = 100;
@@ -118,6 +147,200 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Query - nearest_to without inde
   lancedb_table_free(table);
 }
 
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Query - batched query vectors", "[vector_query]") {
+  const std::string table_name = "vector_query_batch_test";
+  constexpr size_t total_rows = 100;
+  constexpr size_t num_queries = 4;
+  constexpr size_t limit = 3;
+
+  LanceDBTable* table = create_table_with_data(table_name, total_rows, 0);
+  REQUIRE(table != nullptr);
+
+  // Row-major matrix of query vectors
+  std::vector<float> query_matrix;
+  for (size_t q = 0; q < num_queries; q++) {
+    std::vector<float> query_vector = generate_random_query_vector(TEST_SCHEMA_DIMENSIONS);
+    query_matrix.insert(query_matrix.end(), query_vector.begin(), query_vector.end());
+  }
+
+  auto has_field = [](FFI_ArrowSchema* schema, const std::string& name) {
+    ArrowSchema* arrow_schema = reinterpret_cast<ArrowSchema*>(schema);
+    for (int64_t i = 0; i < arrow_schema->n_children; i++) {
+      if (name == arrow_schema->children[i]->name) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  SECTION("nearest_to_batch returns limit results per query vector") {
+    FFI_ArrowArray** result_arrays = nullptr;
+    FFI_ArrowSchema* result_schema = nullptr;
+    size_t count = 0;
+    char* error_message = nullptr;
+
+    LanceDBError result = lancedb_table_nearest_to_batch(
+        table,
+        query_matrix.data(),
+        num_queries,
+        TEST_SCHEMA_DIMENSIONS,
+        limit,
+        "data",
+        &result_arrays,
+        &result_schema,
+        &count,
+        &error_message);
+
+    if (error_message) {
+      INFO("Error: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(result_arrays != nullptr);
+    REQUIRE(result_schema != nullptr);
+    REQUIRE(has_field(result_schema, "query_index"));
+
+    size_t sum_rows = 0;
+    for (size_t i = 0; i < count; i++) {
+      sum_rows += reinterpret_cast<ArrowArray*>(result_arrays[i])->length;
+    }
+    REQUIRE(sum_rows == num_queries * limit);
+
+    lancedb_free_arrow_arrays(result_arrays, count);
+    lancedb_free_arrow_schema(result_schema);
+  }
+
+  SECTION("Batched vector query object") {
+    LanceDBVectorQuery* query = lancedb_vector_query_new_batch(
+        table, query_matrix.data(), num_queries, TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_vector_query_column(query, "data", nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, limit, nullptr) == LANCEDB_SUCCESS);
+
+    LanceDBQueryResult* query_result = lancedb_vector_query_execute(query);
+    REQUIRE(query_result != nullptr);
+
+    FFI_ArrowArray** result_arrays = nullptr;
+    FFI_ArrowSchema* result_schema = nullptr;
+    size_t count = 0;
+    // Converting consumes the query result
+    REQUIRE(lancedb_query_result_to_arrow(query_result, &result_arrays, &result_schema, &count, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(has_field(result_schema, "query_index"));
+
+    size_t sum_rows = 0;
+    for (size_t i = 0; i < count; i++) {
+      sum_rows += reinterpret_cast<ArrowArray*>(result_arrays[i])->length;
+    }
+    REQUIRE(sum_rows == num_queries * limit);
+
+    lancedb_free_arrow_arrays(result_arrays, count);
+    lancedb_free_arrow_schema(result_schema);
+  }
+
+  SECTION("Invalid arguments") {
+    REQUIRE(lancedb_vector_query_new_batch(table, query_matrix.data(), 0, TEST_SCHEMA_DIMENSIONS) == nullptr);
+    REQUIRE(lancedb_vector_query_new_batch(table, nullptr, num_queries, TEST_SCHEMA_DIMENSIONS) == nullptr);
+
+    FFI_ArrowArray** result_arrays = nullptr;
+    FFI_ArrowSchema* result_schema = nullptr;
+    size_t count = 0;
+    REQUIRE(lancedb_table_nearest_to_batch(
+        table, query_matrix.data(), 0, TEST_SCHEMA_DIMENSIONS, limit, "data",
+        &result_arrays, &result_schema, &count, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Query - typed query vectors", "[vector_query]") {
+  const std::string table_name = "vector_query_typed_test";
+  constexpr size_t total_rows = 100;
+  constexpr size_t limit = 5;
+
+  LanceDBTable* table = create_table_with_data(table_name, total_rows, 0);
+  REQUIRE(table != nullptr);
+
+  // Float16 query vector against the float32 data column
+  std::vector<float> query_vector = generate_random_query_vector(TEST_SCHEMA_DIMENSIONS);
+  std::vector<uint16_t> half_vector;
+  for (float value : query_vector) {
+    half_vector.push_back(arrow::util::Float16::FromFloat(value).bits());
+  }
+
+  SECTION("nearest_to_typed with float16 query vector") {
+    FFI_ArrowArray** result_arrays = nullptr;
+    FFI_ArrowSchema* result_schema = nullptr;
+    size_t count = 0;
+    char* error_message = nullptr;
+
+    LanceDBError result = lancedb_table_nearest_to_typed(
+        table,
+        half_vector.data(),
+        LANCEDB_VECTOR_FLOAT16,
+        1,
+        TEST_SCHEMA_DIMENSIONS,
+        limit,
+        "data",
+        &result_arrays,
+        &result_schema,
+        &count,
+        &error_message);
+
+    if (error_message) {
+      INFO("Error: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+
+    size_t sum_rows = 0;
+    for (size_t i = 0; i < count; i++) {
+      sum_rows += reinterpret_cast<ArrowArray*>(result_arrays[i])->length;
+    }
+    REQUIRE(sum_rows == limit);
+
+    lancedb_free_arrow_arrays(result_arrays, count);
+    lancedb_free_arrow_schema(result_schema);
+  }
+
+  SECTION("Typed vector query releases the caller buffer") {
+    std::vector<uint16_t> buffer = half_vector;
+    LanceDBVectorQuery* query = lancedb_vector_query_new_typed(
+        table, buffer.data(), LANCEDB_VECTOR_FLOAT16, 1, TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    // The query owns a copy of the vector
+    std::fill(buffer.begin(), buffer.end(), 0);
+    buffer.clear();
+    buffer.shrink_to_fit();
+
+    REQUIRE(lancedb_vector_query_column(query, "data", nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, limit, nullptr) == LANCEDB_SUCCESS);
+
+    LanceDBQueryResult* query_result = lancedb_vector_query_execute(query);
+    REQUIRE(query_result != nullptr);
+
+    FFI_ArrowArray** result_arrays = nullptr;
+    FFI_ArrowSchema* result_schema = nullptr;
+    size_t count = 0;
+    REQUIRE(lancedb_query_result_to_arrow(query_result, &result_arrays, &result_schema, &count, nullptr) == LANCEDB_SUCCESS);
+
+    size_t sum_rows = 0;
+    for (size_t i = 0; i < count; i++) {
+      sum_rows += reinterpret_cast<ArrowArray*>(result_arrays[i])->length;
+    }
+    REQUIRE(sum_rows == limit);
+
+    lancedb_free_arrow_arrays(result_arrays, count);
+    lancedb_free_arrow_schema(result_schema);
+  }
+
+  SECTION("Invalid arguments") {
+    REQUIRE(lancedb_vector_query_new_typed(table, nullptr, LANCEDB_VECTOR_FLOAT16, 1, TEST_SCHEMA_DIMENSIONS) == nullptr);
+    REQUIRE(lancedb_vector_query_new_typed(table, half_vector.data(), LANCEDB_VECTOR_FLOAT16, 1, 0) == nullptr);
+  }
+
+  lancedb_table_free(table);
+}
+
 TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Query - paged query with limit and offset", "[vector_query]") {
   const std::string table_name = "vector_query_paged_test";
   constexpr size_t total_rows = 100;
@@ -633,6 +856,60 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Query - configuration parameter
     lancedb_free_arrow_schema(result_schema);
   }
 
+  SECTION("Test prefilter and postfilter") {
+    std::vector<float> query_vector = generate_random_query_vector(TEST_SCHEMA_DIMENSIONS);
+
+    // Prefilter (default) always finds the single matching row
+    LanceDBVectorQuery* query = lancedb_vector_query_new(table, query_vector.data(), TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_vector_query_where_filter(query, "key = 'key_7'", nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, 10, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(execute_and_count_rows(query) == 1);
+
+    // Postfilter only keeps matching rows among the nearest neighbors
+    query = lancedb_vector_query_new(table, query_vector.data(), TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_vector_query_where_filter(query, "key = 'key_7'", nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_postfilter(query, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, 10, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(execute_and_count_rows(query) <= 1);
+  }
+
+  SECTION("Test bypass_vector_index with selective filter") {
+    std::vector<float> query_vector = generate_random_query_vector(TEST_SCHEMA_DIMENSIONS);
+
+    LanceDBVectorQuery* query = lancedb_vector_query_new(table, query_vector.data(), TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_vector_query_where_filter(query, "key IN ('key_3', 'key_42')", nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_bypass_vector_index(query, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, 10, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(execute_and_count_rows(query) == 2);
+  }
+
+  SECTION("Test fast_search skips unindexed rows") {
+    // Add rows after the index was built
+    constexpr size_t new_rows = 10;
+    auto reader = create_reader_from_batch(create_test_record_batch(new_rows, total_rows));
+    REQUIRE(lancedb_table_add(table, reader, nullptr) == LANCEDB_SUCCESS);
+
+    std::vector<float> query_vector = generate_random_query_vector(TEST_SCHEMA_DIMENSIONS);
+    constexpr size_t limit = 1000;
+
+    // Probing all 4 partitions covers all indexed rows
+    LanceDBVectorQuery* query = lancedb_vector_query_new(table, query_vector.data(), TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_vector_query_nprobes(query, 4, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, limit, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(execute_and_count_rows(query) == total_rows + new_rows);
+
+    query = lancedb_vector_query_new(table, query_vector.data(), TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_vector_query_nprobes(query, 4, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_fast_search(query, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, limit, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(execute_and_count_rows(query) == total_rows);
+  }
+
   lancedb_table_free(table);
 }
 
@@ -772,6 +1049,306 @@ TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Query - HNSW parameters", "[vec
   lancedb_table_free(table);
 }
 
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Query - multivector", "[vector_query]") {
+  constexpr int total_rows = 20;
+  constexpr int vectors_per_row = 3;
+  constexpr int dimension = 4;
+
+  // Each row holds a few vectors pointing in row-specific directions
+  auto row_vector = [](int row, int j) {
+    float angle = 0.3f * row + 1.1f * j;
+    return std::vector<float>{std::cos(angle), std::sin(angle), 0.5f * j, 1.0f};
+  };
+
+  auto schema = arrow::schema({
+      arrow::field("key", arrow::utf8()),
+      arrow::field("tokens", arrow::list(arrow::fixed_size_list(arrow::float32(), dimension)))});
+
+  arrow::StringBuilder key_builder;
+  auto vector_builder = std::make_shared<arrow::FixedSizeListBuilder>(
+      arrow::default_memory_pool(), std::make_shared<arrow::FloatBuilder>(), dimension);
+  arrow::ListBuilder tokens_builder(arrow::default_memory_pool(), vector_builder);
+  auto* value_builder = static_cast<arrow::FloatBuilder*>(vector_builder->value_builder());
+  for (int i = 0; i < total_rows; i++) {
+    REQUIRE(key_builder.Append("key_" + std::to_string(i)).ok());
+    REQUIRE(tokens_builder.Append().ok());
+    for (int j = 0; j < vectors_per_row; j++) {
+      REQUIRE(vector_builder->Append().ok());
+      REQUIRE(value_builder->AppendValues(row_vector(i, j)).ok());
+    }
+  }
+  std::shared_ptr<arrow::Array> key_array, tokens_array;
+  REQUIRE(key_builder.Finish(&key_array).ok());
+  REQUIRE(tokens_builder.Finish(&tokens_array).ok());
+  auto batch = arrow::RecordBatch::Make(schema, total_rows, {key_array, tokens_array});
+
+  struct ArrowSchema c_schema;
+  REQUIRE(arrow::ExportSchema(*schema, &c_schema).ok());
+  LanceDBTable* table = nullptr;
+  REQUIRE(lancedb_table_create(db, "multivector_test", reinterpret_cast<FFI_ArrowSchema*>(&c_schema),
+                               create_reader_from_batch(batch), &table, nullptr) == LANCEDB_SUCCESS);
+  if (c_schema.release) {
+    c_schema.release(&c_schema);
+  }
+
+  SECTION("Max-sim query finds the row with the query's vectors") {
+    constexpr int target = 7;
+    std::vector<float> query_vectors;
+    for (int j = 0; j < vectors_per_row; j++) {
+      auto v = row_vector(target, j);
+      query_vectors.insert(query_vectors.end(), v.begin(), v.end());
+    }
+
+    LanceDBVectorQuery* query = lancedb_vector_query_new_multivector(
+        table, query_vectors.data(), vectors_per_row, dimension);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_vector_query_column(query, "tokens", nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_distance_type(query, LANCEDB_DISTANCE_COSINE, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, 3, nullptr) == LANCEDB_SUCCESS);
+
+    LanceDBQueryResult* query_result = lancedb_vector_query_execute(query);
+    REQUIRE(query_result != nullptr);
+
+    struct ArrowArrayStream c_stream;
+    REQUIRE(lancedb_query_result_to_arrow_stream(
+        query_result, reinterpret_cast<FFI_ArrowArrayStream*>(&c_stream), nullptr) == LANCEDB_SUCCESS);
+    auto reader = arrow::ImportRecordBatchReader(&c_stream);
+    REQUIRE(reader.ok());
+    // One query, not a batch of queries
+    REQUIRE((*reader)->schema()->GetFieldByName("query_index") == nullptr);
+
+    auto table_result = (*reader)->ToTable();
+    REQUIRE(table_result.ok());
+    auto results = (*table_result)->CombineChunksToBatch();
+    REQUIRE(results.ok());
+    REQUIRE((*results)->num_rows() == 3);
+    auto keys = std::static_pointer_cast<arrow::StringArray>((*results)->GetColumnByName("key"));
+    REQUIRE(keys != nullptr);
+    REQUIRE(keys->GetString(0) == "key_" + std::to_string(target));
+  }
+
+  SECTION("Invalid arguments") {
+    float vectors[dimension] = {1.0f, 0.0f, 0.0f, 0.0f};
+    REQUIRE(lancedb_vector_query_new_multivector(nullptr, vectors, 1, dimension) == nullptr);
+    REQUIRE(lancedb_vector_query_new_multivector(table, nullptr, 1, dimension) == nullptr);
+    REQUIRE(lancedb_vector_query_new_multivector(table, vectors, 0, dimension) == nullptr);
+  }
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Query - row IDs and take", "[vector_query]") {
+  constexpr size_t total_rows = 100;
+  constexpr size_t limit = 5;
+  LanceDBTable* table = create_table_with_data("row_id_test", total_rows, 0);
+  REQUIRE(table != nullptr);
+
+  // Read all batches of a query result into one batch
+  auto read_result = [](LanceDBQueryResult* query_result) {
+    REQUIRE(query_result != nullptr);
+    struct ArrowArrayStream c_stream;
+    REQUIRE(lancedb_query_result_to_arrow_stream(
+        query_result, reinterpret_cast<FFI_ArrowArrayStream*>(&c_stream), nullptr) == LANCEDB_SUCCESS);
+    auto reader = arrow::ImportRecordBatchReader(&c_stream);
+    REQUIRE(reader.ok());
+    auto result_table = (*reader)->ToTable();
+    REQUIRE(result_table.ok());
+    auto batch = (*result_table)->CombineChunksToBatch();
+    REQUIRE(batch.ok());
+    return *batch;
+  };
+  // Take rows and return their keys
+  auto take_keys = [&](const std::vector<unsigned long long>& row_ids) {
+    const char* columns[] = {"key"};
+    FFI_ArrowArray** result_arrays = nullptr;
+    FFI_ArrowSchema* result_schema = nullptr;
+    size_t count = 0;
+    char* error_message = nullptr;
+    LanceDBError result = lancedb_table_take_row_ids(
+        table, row_ids.data(), row_ids.size(), columns, 1, &result_arrays, &result_schema, &count, &error_message);
+    if (error_message) {
+      INFO("Error taking rows: " << error_message);
+      lancedb_free_string(error_message);
+    }
+    REQUIRE(result == LANCEDB_SUCCESS);
+    REQUIRE(count == 1);
+    REQUIRE(reinterpret_cast<ArrowSchema*>(result_schema)->n_children == 1);
+
+    auto batch = arrow::ImportRecordBatch(
+        reinterpret_cast<ArrowArray*>(result_arrays[0]), reinterpret_cast<ArrowSchema*>(result_schema));
+    REQUIRE(batch.ok());
+    auto key_array = std::static_pointer_cast<arrow::StringArray>((*batch)->column(0));
+    std::vector<std::string> keys;
+    for (int64_t i = 0; i < key_array->length(); i++) {
+      keys.push_back(key_array->GetString(i));
+    }
+    lancedb_free_arrow_arrays(result_arrays, count);
+    lancedb_free_arrow_schema(result_schema);
+    return keys;
+  };
+
+  std::vector<float> query_vector = generate_random_query_vector(TEST_SCHEMA_DIMENSIONS);
+
+  SECTION("Search returns only row IDs and distances, take fetches the payload") {
+    LanceDBVectorQuery* query = lancedb_vector_query_new(table, query_vector.data(), TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    const char* no_columns[] = {nullptr};
+    REQUIRE(lancedb_vector_query_select(query, no_columns, 0, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_with_row_id(query, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, limit, nullptr) == LANCEDB_SUCCESS);
+    auto search = read_result(lancedb_vector_query_execute(query));
+    REQUIRE(search->num_rows() == static_cast<int64_t>(limit));
+    REQUIRE(search->num_columns() == 2);
+    REQUIRE(search->GetColumnByName("_distance") != nullptr);
+    auto row_id_array = std::static_pointer_cast<arrow::UInt64Array>(search->GetColumnByName("_rowid"));
+    REQUIRE(row_id_array != nullptr);
+    std::vector<unsigned long long> row_ids(row_id_array->raw_values(), row_id_array->raw_values() + limit);
+
+    // Same search projecting the keys directly
+    query = lancedb_vector_query_new(table, query_vector.data(), TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    const char* key_column[] = {"key"};
+    REQUIRE(lancedb_vector_query_select(query, key_column, 1, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, limit, nullptr) == LANCEDB_SUCCESS);
+    auto reference = read_result(lancedb_vector_query_execute(query));
+    auto reference_keys = std::static_pointer_cast<arrow::StringArray>(reference->GetColumnByName("key"));
+
+    // Taken rows come back in the order of the row IDs
+    auto keys = take_keys(row_ids);
+    REQUIRE(keys.size() == limit);
+    for (size_t i = 0; i < limit; i++) {
+      REQUIRE(keys[i] == reference_keys->GetString(i));
+    }
+  }
+
+  SECTION("Plain query with row IDs") {
+    LanceDBQuery* query = lancedb_query_new(table);
+    REQUIRE(query != nullptr);
+    REQUIRE(lancedb_query_where_filter(query, "key = 'key_42'", nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_query_with_row_id(query, nullptr) == LANCEDB_SUCCESS);
+    auto batch = read_result(lancedb_query_execute(query));
+    REQUIRE(batch->num_rows() == 1);
+    auto row_id_array = std::static_pointer_cast<arrow::UInt64Array>(batch->GetColumnByName("_rowid"));
+    REQUIRE(row_id_array != nullptr);
+
+    auto keys = take_keys({row_id_array->Value(0)});
+    REQUIRE(keys.size() == 1);
+    REQUIRE(keys[0] == "key_42");
+  }
+
+  SECTION("Invalid arguments") {
+    FFI_ArrowArray** result_arrays = nullptr;
+    FFI_ArrowSchema* result_schema = nullptr;
+    size_t count = 0;
+    unsigned long long row_id = 0;
+    REQUIRE(lancedb_table_take_row_ids(nullptr, &row_id, 1, nullptr, 0, &result_arrays, &result_schema, &count, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_take_row_ids(table, nullptr, 1, nullptr, 0, &result_arrays, &result_schema, &count, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_table_take_row_ids(table, &row_id, 0, nullptr, 0, &result_arrays, &result_schema, &count, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_query_with_row_id(nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+    REQUIRE(lancedb_vector_query_with_row_id(nullptr, nullptr) == LANCEDB_INVALID_ARGUMENT);
+  }
+
+  lancedb_table_free(table);
+}
+
+TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Query - coalesced queries", "[vector_query]") {
+  LanceDBTable* fixture_table = create_table_with_data("coalesce_test", 100, 0);
+  REQUIRE(fixture_table != nullptr);
+  lancedb_table_free(fixture_table);
+
+  LanceDBConnectBuilder* builder = lancedb_connect(uri.c_str());
+  REQUIRE(builder != nullptr);
+  builder = lancedb_connect_builder_query_coalescing(builder, 50000, 16);
+  REQUIRE(builder != nullptr);
+  LanceDBConnection* coalescing_db = lancedb_connect_builder_execute(builder);
+  REQUIRE(coalescing_db != nullptr);
+  LanceDBTable* table = lancedb_connection_open_table(coalescing_db, "coalesce_test");
+  REQUIRE(table != nullptr);
+
+  // Keys of a query result, in result order
+  auto read_keys = [](LanceDBQueryResult* query_result) {
+    REQUIRE(query_result != nullptr);
+    struct ArrowArrayStream c_stream;
+    REQUIRE(lancedb_query_result_to_arrow_stream(
+        query_result, reinterpret_cast<FFI_ArrowArrayStream*>(&c_stream), nullptr) == LANCEDB_SUCCESS);
+    auto reader = arrow::ImportRecordBatchReader(&c_stream);
+    REQUIRE(reader.ok());
+    // Callers never see the query_index column of the shared multi-vector query
+    REQUIRE((*reader)->schema()->GetFieldByName("query_index") == nullptr);
+    auto result_table = (*reader)->ToTable();
+    REQUIRE(result_table.ok());
+    std::vector<std::string> keys;
+    auto key_column = (*result_table)->GetColumnByName("key");
+    for (const auto& chunk : key_column->chunks()) {
+      auto key_array = std::static_pointer_cast<arrow::StringArray>(chunk);
+      for (int64_t i = 0; i < key_array->length(); i++) {
+        keys.push_back(key_array->GetString(i));
+      }
+    }
+    return keys;
+  };
+  // Query vector equal to the data vector of row idx
+  auto row_vector = [](int idx) {
+    std::vector<float> vector(TEST_SCHEMA_DIMENSIONS);
+    for (size_t j = 0; j < TEST_SCHEMA_DIMENSIONS; j++) {
+      vector[j] = static_cast<float>(idx * 10 + j);
+    }
+    return vector;
+  };
+  auto new_query = [&](int idx) {
+    std::vector<float> vector = row_vector(idx);
+    LanceDBVectorQuery* query = lancedb_vector_query_new(table, vector.data(), TEST_SCHEMA_DIMENSIONS);
+    REQUIRE(query != nullptr);
+    const char* columns[] = {"key"};
+    REQUIRE(lancedb_vector_query_select(query, columns, 1, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(lancedb_vector_query_limit(query, 3, nullptr) == LANCEDB_SUCCESS);
+    return query;
+  };
+
+  SECTION("Concurrent queries share one execution") {
+    LanceDBOperationMetrics before;
+    REQUIRE(lancedb_metrics_operation("vector_query_coalesced", &before, nullptr) == LANCEDB_SUCCESS);
+
+    // Each row is queried twice, so duplicates are deduplicated as well
+    const std::vector<int> rows = {3, 17, 42, 88, 3, 17, 42, 88};
+    std::vector<LanceDBFuture*> futures;
+    for (int row : rows) {
+      LanceDBFuture* future = lancedb_vector_query_execute_async(new_query(row), nullptr, nullptr);
+      REQUIRE(future != nullptr);
+      futures.push_back(future);
+    }
+
+    for (size_t i = 0; i < futures.size(); i++) {
+      LanceDBQueryResult* query_result = nullptr;
+      char* error_message = nullptr;
+      LanceDBError result = lancedb_future_get_query_result(futures[i], &query_result, &error_message);
+      if (error_message) {
+        INFO("Error executing query: " << error_message);
+        lancedb_free_string(error_message);
+      }
+      REQUIRE(result == LANCEDB_SUCCESS);
+      auto keys = read_keys(query_result);
+      REQUIRE(keys.size() == 3);
+      REQUIRE(keys[0] == "key_" + std::to_string(rows[i]));
+    }
+
+    LanceDBOperationMetrics after;
+    REQUIRE(lancedb_metrics_operation("vector_query_coalesced", &after, nullptr) == LANCEDB_SUCCESS);
+    REQUIRE(after.calls > before.calls);
+    REQUIRE(after.calls - before.calls < rows.size());
+    REQUIRE(after.errors == before.errors);
+  }
+
+  SECTION("A single query runs alone after the window") {
+    auto keys = read_keys(lancedb_vector_query_execute(new_query(42)));
+    REQUIRE(keys.size() == 3);
+    REQUIRE(keys[0] == "key_42");
+  }
+
+  lancedb_table_free(table);
+  lancedb_connection_free(coalescing_db);
+}
+
 TEST_CASE_METHOD(LanceDBFixture, "LanceDB Vector Query - error cases", "[vector_query]") {
   const std::string table_name = "vector_query_error_test";
 